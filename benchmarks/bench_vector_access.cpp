@@ -0,0 +1,70 @@
+/*
+ * element access benchmarks for my_vector
+ * build in Release (NDEBUG -> unchecked operator[]) and run the executable directly, these are not part of ctest
+ * bench_vector_access_checked is the same file built with MYSTL_BOUNDS_CHECK=1
+ * bench_vector_access_checked_iterators is the same file built with MYSTL_CHECKED_ITERATORS=1
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <string>
+
+namespace
+{
+
+constexpr size_t element_count = 1 << 16;
+
+#if MYSTL_BOUNDS_CHECK
+constexpr const char* mode = " [checked operator[]]";
+#else
+constexpr const char* mode = " [unchecked operator[]]";
+#endif
+
+#if MYSTL_CHECKED_ITERATORS
+constexpr const char* iterator_mode = " [checked iterators]";
+#else
+constexpr const char* iterator_mode = " [raw pointer iterators]";
+#endif
+
+}
+
+TEST_CASE("bench sum kernel", "[benchmark]") {
+    //integer sum, a float sum cant be vectorized without -ffast-math no matter how the elements are accessed
+    mystl::my_vector<unsigned> v(element_count);
+    for(size_t i = 0; i<element_count; i++) v[i] = static_cast<unsigned>(i % 7);
+
+    BENCHMARK(std::string("sum with operator[]") + mode) {
+        unsigned sum = 0;
+        for(size_t i = 0; i<v.size(); i++) sum += v[i];
+        return sum;
+    };
+    BENCHMARK("sum with at()") {
+        unsigned sum = 0;
+        for(size_t i = 0; i<v.size(); i++) sum += v.at(i);
+        return sum;
+    };
+    BENCHMARK(std::string("sum with iterators") + iterator_mode) {
+        unsigned sum = 0;
+        for(unsigned x : v) sum += x;
+        return sum;
+    };
+}
+
+TEST_CASE("bench scale kernel", "[benchmark]") {
+    mystl::my_vector<float> src(element_count);
+    mystl::my_vector<float> dst(element_count);
+    for(size_t i = 0; i<element_count; i++) src[i] = static_cast<float>(i % 7);
+
+    BENCHMARK(std::string("scale with operator[]") + mode) {
+        for(size_t i = 0; i<src.size(); i++) dst[i] = src[i] * 1.5f;
+        return dst[0];
+    };
+    BENCHMARK("scale with at()") {
+        for(size_t i = 0; i<src.size(); i++) dst.at(i) = src.at(i) * 1.5f;
+        return dst[0];
+    };
+    BENCHMARK(std::string("scale with iterators") + iterator_mode) {
+        auto out = dst.begin();
+        for(auto it = src.begin(); it!=src.end(); ++it, ++out) *out = *it * 1.5f;
+        return dst[0];
+    };
+}
@@ -0,0 +1,57 @@
+/*
+ * bulk append benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * every case refills a vector with the same generated values, like a parser does with its output
+ * the storage is allocated once up front, so page faults dont hide the cost of the loop itself
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t element_count = 1 << 20;
+
+std::uint32_t value(size_t i)
+{
+    return static_cast<std::uint32_t>(i * 2654435761u);
+}
+
+}
+
+TEST_CASE("bench append", "[benchmark]") {
+    std::vector<std::uint32_t> sv;
+    sv.reserve(element_count);
+    mystl::my_vector<std::uint32_t> v;
+    v.reserve(element_count);
+
+    BENCHMARK("std::vector push_back") {
+        sv.clear();
+        for(size_t i = 0; i<element_count; i++) sv.push_back(value(i));
+        return sv.size();
+    };
+    BENCHMARK("my_vector push_back") {
+        v.clear();
+        for(size_t i = 0; i<element_count; i++) v.push_back(value(i));
+        return v.size();
+    };
+    BENCHMARK("my_vector push_back_unchecked") {
+        v.clear();
+        for(size_t i = 0; i<element_count; i++) v.push_back_unchecked(value(i));
+        return v.size();
+    };
+    BENCHMARK("my_vector append_n") {
+        v.clear();
+        size_t i = 0;
+        v.append_n(element_count, [&i]{ return value(i++); });
+        return v.size();
+    };
+    BENCHMARK("my_vector uninitialized_append") {
+        v.clear();
+        std::uint32_t* dest = v.uninitialized_append(element_count);
+        for(size_t i = 0; i<element_count; i++) dest[i] = value(i);
+        return v.size();
+    };
+}
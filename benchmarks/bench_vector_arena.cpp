@@ -0,0 +1,101 @@
+/*
+ * arena allocation benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * every thread handles requests that build a handful of short lived vectors, either on the global heap
+ * or in a per thread monotonic_arena with a stack buffer that is released once per request
+ * MYSTL_BENCH_THREADS sets the thread count of the multi threaded cases (default: hardware threads, at least 4)
+ */
+#include "../source/arena.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t requests_per_thread = 2000;
+constexpr size_t vectors_per_request = 16;
+constexpr size_t elements_per_vector = 200;
+
+size_t thread_count()
+{
+    if(const char* env = std::getenv("MYSTL_BENCH_THREADS")) return std::strtoull(env, nullptr, 10);
+    size_t hw = std::thread::hardware_concurrency();
+    return (hw<4)?4:hw;
+}
+
+//the allocations of one request, vectors that all die at the end of it
+template<typename Vec, typename Alloc>
+std::uint64_t handle_request(const Alloc& alloc, size_t seed)
+{
+    std::uint64_t sum = 0;
+    for(size_t r = 0; r<vectors_per_request; r++)
+    {
+        Vec ids(alloc);
+        Vec scores(alloc);
+        for(size_t i = 0; i<elements_per_vector; i++)
+        {
+            ids.push_back(static_cast<std::uint32_t>(seed + i));
+            if(i % 3==0) scores.push_back(static_cast<std::uint32_t>(i * r));
+        }
+        sum += ids[ids.size() - 1] + scores.size();
+    }
+    return sum;
+}
+
+std::uint64_t heap_worker()
+{
+    using vec = mystl::my_vector<std::uint32_t>;
+    std::uint64_t sum = 0;
+    for(size_t q = 0; q<requests_per_thread; q++) sum += handle_request<vec>(std::allocator<std::uint32_t>(), q);
+    return sum;
+}
+
+std::uint64_t arena_worker()
+{
+    using vec = mystl::my_vector<std::uint32_t, mystl::arena_allocator<std::uint32_t>>;
+    alignas(std::max_align_t) unsigned char buffer[16 * 1024];
+    mystl::monotonic_arena arena(buffer, sizeof(buffer));
+    std::uint64_t sum = 0;
+    for(size_t q = 0; q<requests_per_thread; q++)
+    {
+        sum += handle_request<vec>(mystl::arena_allocator<std::uint32_t>(arena), q);
+        //one bulk release per request instead of one free per vector
+        arena.release();
+    }
+    return sum;
+}
+
+//runs worker on threads threads at once, returns the combined result
+template<typename Worker>
+std::uint64_t run_threads(size_t threads, Worker worker)
+{
+    std::vector<std::uint64_t> results(threads);
+    std::vector<std::thread> pool;
+    for(size_t t = 0; t<threads; t++) pool.emplace_back([&results, t, worker]{ results[t] = worker(); });
+    std::uint64_t sum = 0;
+    for(size_t t = 0; t<threads; t++)
+    {
+        pool[t].join();
+        sum += results[t];
+    }
+    return sum;
+}
+
+}
+
+TEST_CASE("bench arena per request allocation", "[benchmark]") {
+    size_t threads = thread_count();
+    std::cout << "threads: " << threads << ", requests per thread: " << requests_per_thread << "\n";
+    std::string many = std::to_string(threads) + " threads";
+
+    BENCHMARK("global heap, 1 thread") { return run_threads(1, heap_worker); };
+    BENCHMARK("arena, 1 thread") { return run_threads(1, arena_worker); };
+    BENCHMARK("global heap, " + many) { return run_threads(threads, heap_worker); };
+    BENCHMARK("arena, " + many) { return run_threads(threads, arena_worker); };
+}
@@ -0,0 +1,73 @@
+/*
+ * comparison benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t key_count = 1000000;
+constexpr size_t key_length = 12;
+
+//keys with few distinct values so sorting and dedup see lots of equal prefixes
+template<typename Vec>
+std::vector<Vec> make_keys()
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::uint32_t> dist(0, 3);
+    std::vector<Vec> keys(key_count);
+    for(auto& key : keys)
+    {
+        for(size_t i = 0; i<key_length; i++) key.push_back(dist(rng));
+    }
+    return keys;
+}
+
+//element by element like the old member operator==
+bool equal_loop(const mystl::my_vector<std::uint32_t>& a, const mystl::my_vector<std::uint32_t>& b)
+{
+    if(a.size()!=b.size()) return false;
+    for(size_t i = 0; i<a.size(); i++)
+    {
+        if(a[i]!=b[i]) return false;
+    }
+    return true;
+}
+
+}
+
+TEST_CASE("bench equality of long vectors", "[benchmark]") {
+    mystl::my_vector<std::uint32_t> a(1 << 20);
+    mystl::my_vector<std::uint32_t> b(1 << 20);
+
+    BENCHMARK("my_vector<uint32_t> operator== (memcmp)") { return a==b; };
+    BENCHMARK("my_vector<uint32_t> element loop") { return equal_loop(a, b); };
+}
+
+TEST_CASE("bench dedup of short keys", "[benchmark]") {
+    auto my_keys = make_keys<mystl::my_vector<std::uint32_t>>();
+    auto std_keys = make_keys<std::vector<std::uint32_t>>();
+
+    BENCHMARK_ADVANCED("my_vector<uint32_t> sort + unique")(Catch::Benchmark::Chronometer meter) {
+        std::vector<decltype(my_keys)> runs(meter.runs(), my_keys);
+        meter.measure([&](int i) {
+            auto& keys = runs[i];
+            std::sort(keys.begin(), keys.end());
+            return std::unique(keys.begin(), keys.end()) - keys.begin();
+        });
+    };
+    BENCHMARK_ADVANCED("std::vector<uint32_t> sort + unique")(Catch::Benchmark::Chronometer meter) {
+        std::vector<decltype(std_keys)> runs(meter.runs(), std_keys);
+        meter.measure([&](int i) {
+            auto& keys = runs[i];
+            std::sort(keys.begin(), keys.end());
+            return std::unique(keys.begin(), keys.end()) - keys.begin();
+        });
+    };
+}
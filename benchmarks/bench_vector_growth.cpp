@@ -0,0 +1,113 @@
+/*
+ * growth policy benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * "growth policy statistics" prints reallocation counts, slack and peak memory for every policy
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+constexpr size_t element_count = 50000000;
+
+struct growth_stats
+{
+    size_t reallocations = 0;
+    size_t final_bytes = 0;
+    //largest old + new block that had to exist at the same time during a reallocation
+    size_t peak_bytes = 0;
+};
+
+template<typename Growth>
+growth_stats measure_growth()
+{
+    growth_stats stats;
+    mystl::my_vector<std::uint64_t, std::allocator<std::uint64_t>, Growth> v;
+    size_t cap = 0;
+    for(size_t i = 0; i<element_count; i++)
+    {
+        v.push_back(i);
+        if(v.capacity()!=cap)
+        {
+            stats.reallocations++;
+            size_t both = (cap + v.capacity()) * sizeof(std::uint64_t);
+            if(both>stats.peak_bytes) stats.peak_bytes = both;
+            cap = v.capacity();
+        }
+    }
+    stats.final_bytes = cap * sizeof(std::uint64_t);
+    return stats;
+}
+
+//peak resident set of a child process that only fills one vector, -1 where fork isnt available
+template<typename Growth>
+long peak_rss_kib()
+{
+#if defined(__linux__)
+    pid_t pid = fork();
+    if(pid==0)
+    {
+        mystl::my_vector<std::uint64_t, std::allocator<std::uint64_t>, Growth> v;
+        for(size_t i = 0; i<element_count; i++) v.push_back(i);
+        _exit(v.size()==element_count?0:1);
+    }
+    int status = 0;
+    rusage usage{};
+    wait4(pid, &status, 0, &usage);
+    return usage.ru_maxrss;
+#else
+    return -1;
+#endif
+}
+
+template<typename Growth>
+void report(const std::string& name)
+{
+    growth_stats stats = measure_growth<Growth>();
+    long rss = peak_rss_kib<Growth>();
+    size_t used = element_count * sizeof(std::uint64_t);
+    std::cout << name
+              << "  reallocations: " << stats.reallocations
+              << "  final block: " << (stats.final_bytes >> 20) << " MiB"
+              << "  slack: " << ((stats.final_bytes - used) >> 20) << " MiB"
+              << "  peak old+new: " << (stats.peak_bytes >> 20) << " MiB"
+              << "  peak rss: " << (rss<0?std::string("n/a"):std::to_string(rss >> 10) + " MiB")
+              << '\n';
+}
+
+template<typename Growth>
+size_t fill()
+{
+    mystl::my_vector<std::uint64_t, std::allocator<std::uint64_t>, Growth> v;
+    for(size_t i = 0; i<element_count; i++) v.push_back(i);
+    return v.size();
+}
+
+}
+
+TEST_CASE("growth policy statistics", "[benchmark]") {
+    std::cout << "pushing " << element_count << " uint64_t\n";
+    report<mystl::growth::doubling>("doubling     ");
+    report<mystl::growth::one_and_half>("one_and_half ");
+    report<mystl::growth::size_class>("size_class   ");
+    report<mystl::growth::page_rounded>("page_rounded ");
+    report<mystl::growth::chunked<>>("chunked 64MiB");
+}
+
+TEST_CASE("bench growth policies", "[benchmark]") {
+    BENCHMARK("doubling push_back") { return fill<mystl::growth::doubling>(); };
+    BENCHMARK("one_and_half push_back") { return fill<mystl::growth::one_and_half>(); };
+    BENCHMARK("size_class push_back") { return fill<mystl::growth::size_class>(); };
+    BENCHMARK("page_rounded push_back") { return fill<mystl::growth::page_rounded>(); };
+    BENCHMARK("chunked 64MiB push_back") { return fill<mystl::growth::chunked<>>(); };
+}
@@ -0,0 +1,150 @@
+/*
+ * huge page benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * MYSTL_BENCH_HUGEPAGE_MB sets the vector size in MiB (default 1024), use a few GB to see the TLB effect
+ * the THP mode of the kernel and the huge page backed memory of each vector are printed first
+ * "bench huge page growth" compares growing by mremap with growing by copy and prints the bytes mremap didnt copy
+ */
+#include "../source/huge_page_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+size_t element_count()
+{
+    size_t mb = 1024;
+    if(const char* env = std::getenv("MYSTL_BENCH_HUGEPAGE_MB")) mb = std::strtoull(env, nullptr, 10);
+    return (mb << 20) / sizeof(float);
+}
+
+//first line of a file, empty if it cant be read
+std::string read_line(const char* path)
+{
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);
+    return line;
+}
+
+//AnonHugePages of the whole process in kB, -1 where there is no /proc
+long long anon_huge_kb()
+{
+    std::ifstream in("/proc/self/smaps_rollup");
+    std::string key;
+    long long value = 0;
+    while(in>>key>>value)
+    {
+        if(key=="AnonHugePages:") return value;
+        in.ignore(256, '\n');
+    }
+    return -1;
+}
+
+template<typename Vec>
+void fill(Vec& v, size_t n)
+{
+    v.resize(n);
+    for(size_t i = 0; i<n; i++) v[i] = static_cast<float>(i & 1023);
+}
+
+template<typename Vec>
+float sequential_sum(const Vec& v)
+{
+    float sum = 0.0f;
+    for(float x : v) sum += x;
+    return sum;
+}
+
+//dependent random reads, every access is likely a TLB miss with 4 KiB pages
+template<typename Vec>
+float random_sum(const Vec& v, size_t reads)
+{
+    float sum = 0.0f;
+    std::uint64_t state = 0x9E3779B97F4A7C15ull;
+    size_t n = v.size();
+    for(size_t i = 0; i<reads; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        size_t id = static_cast<size_t>((state >> 17) % n);
+        sum += v[id];
+    }
+    return sum;
+}
+
+constexpr size_t random_reads = 1 << 22;
+
+//huge_page_allocator without the reallocate hook -> every growth is a new mapping and a copy
+template<typename T>
+struct copying_huge_page_allocator
+{
+    using value_type = T;
+
+    copying_huge_page_allocator() noexcept = default;
+    template<typename U>
+    copying_huge_page_allocator(const copying_huge_page_allocator<U>&) noexcept{}
+
+    T* allocate(size_t n) { return base.allocate(n); }
+    mystl::allocation_result<T*> allocate_at_least(size_t n) { return base.allocate_at_least(n); }
+    void deallocate(T* p, size_t n) noexcept { base.deallocate(p, n); }
+
+    bool operator == (const copying_huge_page_allocator&) const noexcept { return true; }
+    bool operator != (const copying_huge_page_allocator&) const noexcept { return false; }
+
+    mystl::huge_page_allocator<T> base;
+};
+
+template<typename Vec>
+size_t grow(size_t n)
+{
+    Vec v;
+    for(size_t i = 0; i<n; i++) v.push_back(static_cast<std::uint64_t>(i));
+    return v.size();
+}
+
+}
+
+TEST_CASE("bench huge page backed vector", "[benchmark]") {
+    size_t n = element_count();
+    std::cout << "THP mode: " << read_line("/sys/kernel/mm/transparent_hugepage/enabled") << "\n"
+              << "vector size: " << ((n * sizeof(float)) >> 20) << " MiB\n";
+
+    long long before = anon_huge_kb();
+    auto huge = std::make_unique<mystl::my_vector<float, mystl::huge_page_allocator<float>>>();
+    fill(*huge, n);
+    std::cout << "huge_page_allocator AnonHugePages: " << (anon_huge_kb() - before) / 1024 << " MiB\n";
+
+    before = anon_huge_kb();
+    auto plain = std::make_unique<mystl::my_vector<float>>();
+    fill(*plain, n);
+    std::cout << "std::allocator AnonHugePages: " << (anon_huge_kb() - before) / 1024 << " MiB\n";
+
+    BENCHMARK("std::allocator sequential sum") { return sequential_sum(*plain); };
+    BENCHMARK("huge_page_allocator sequential sum") { return sequential_sum(*huge); };
+    BENCHMARK("std::allocator random reads") { return random_sum(*plain, random_reads); };
+    BENCHMARK("huge_page_allocator random reads") { return random_sum(*huge, random_reads); };
+}
+
+TEST_CASE("bench huge page growth", "[benchmark]") {
+    size_t n = element_count() * sizeof(float) / sizeof(std::uint64_t);
+    using remapping = mystl::my_vector<std::uint64_t, mystl::huge_page_allocator<std::uint64_t>>;
+    using copying = mystl::my_vector<std::uint64_t, copying_huge_page_allocator<std::uint64_t>>;
+
+    mystl::huge_page_stats before = mystl::huge_page_allocator<std::uint64_t>::stats();
+    grow<remapping>(n);
+    mystl::huge_page_stats after = mystl::huge_page_allocator<std::uint64_t>::stats();
+    std::cout << "push_back of " << ((n * sizeof(std::uint64_t)) >> 20) << " MiB: "
+              << (after.remaps - before.remaps) << " remaps, "
+              << ((after.bytes_not_copied - before.bytes_not_copied) >> 20) << " MiB not copied\n";
+
+    BENCHMARK("std::allocator push_back growth") { return grow<mystl::my_vector<std::uint64_t>>(n); };
+    BENCHMARK("huge_page_allocator push_back growth (copy)") { return grow<copying>(n); };
+    BENCHMARK("huge_page_allocator push_back growth (mremap)") { return grow<remapping>(n); };
+}
@@ -0,0 +1,118 @@
+/*
+ * insert/erase benchmarks for my_vector against std::vector
+ * build in Release and run the executable directly, these are not part of ctest
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t base_size = 100000;
+constexpr size_t op_count = 1000;
+
+enum class position { front, middle, tail };
+
+size_t index_for(position where, size_t size)
+{
+    switch(where)
+    {
+        case position::front: return 0;
+        case position::middle: return size / 2;
+        default: return size;
+    }
+}
+
+template<typename Vec, typename Make>
+Vec make_filled(Make make)
+{
+    Vec v;
+    v.reserve(base_size + op_count);
+    for(size_t i = 0; i<base_size; i++)
+    {
+        v.push_back(make(i));
+    }
+    return v;
+}
+
+//op_count inserts at the given position followed by op_count erases at the same position
+template<typename Vec, typename Make>
+size_t insert_then_erase(Vec& v, position where, Make make)
+{
+    for(size_t i = 0; i<op_count; i++)
+    {
+        v.insert(v.begin() + index_for(where, v.size()), make(i));
+    }
+    for(size_t i = 0; i<op_count; i++)
+    {
+        size_t id = index_for(where, v.size() - 1);
+        v.erase(v.begin() + id);
+    }
+    return v.size();
+}
+
+template<typename Elem, typename Make>
+void bench_positions(const std::string& name, Make make)
+{
+    const position positions[] = {position::front, position::middle, position::tail};
+    const char* position_names[] = {"front", "middle", "tail"};
+    for(size_t p = 0; p<3; p++)
+    {
+        auto my = make_filled<mystl::my_vector<Elem>>(make);
+        auto stl = make_filled<std::vector<Elem>>(make);
+        BENCHMARK("my_vector<" + name + "> insert+erase " + position_names[p]) {
+            return insert_then_erase(my, positions[p], make);
+        };
+        BENCHMARK("std::vector<" + name + "> insert+erase " + position_names[p]) {
+            return insert_then_erase(stl, positions[p], make);
+        };
+    }
+}
+
+}
+
+TEST_CASE("bench insert and erase positions", "[benchmark]") {
+    bench_positions<int>("int", [](size_t i) { return static_cast<int>(i); });
+    //relocatable but not trivially copyable -> memmove for my_vector, move_backward for std::vector
+    bench_positions<std::unique_ptr<int>>("unique_ptr<int>", [](size_t i) { return std::make_unique<int>(static_cast<int>(i)); });
+}
+
+TEST_CASE("bench range insert", "[benchmark]") {
+    std::vector<int> src(op_count * 10, 7);
+
+    BENCHMARK("my_vector<int> range insert middle") {
+        auto v = make_filled<mystl::my_vector<int>>([](size_t i) { return static_cast<int>(i); });
+        v.insert(v.begin() + v.size() / 2, src.begin(), src.end());
+        return v.size();
+    };
+    BENCHMARK("std::vector<int> range insert middle") {
+        auto v = make_filled<std::vector<int>>([](size_t i) { return static_cast<int>(i); });
+        v.insert(v.begin() + v.size() / 2, src.begin(), src.end());
+        return v.size();
+    };
+}
+
+TEST_CASE("bench erase_if compaction", "[benchmark]") {
+    auto make = [](size_t i) { return std::make_unique<int>(static_cast<int>(i)); };
+    auto odd = [](const std::unique_ptr<int>& p) { return *p % 2 == 1; };
+
+    BENCHMARK_ADVANCED("my_vector<unique_ptr<int>> erase_if half")(Catch::Benchmark::Chronometer meter) {
+        std::vector<mystl::my_vector<std::unique_ptr<int>>> vs;
+        for(int i = 0; i<meter.runs(); i++) vs.push_back(make_filled<mystl::my_vector<std::unique_ptr<int>>>(make));
+        meter.measure([&](int i) { return mystl::erase_if(vs[i], odd); });
+    };
+    BENCHMARK_ADVANCED("std::vector<unique_ptr<int>> remove_if + erase half")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<std::unique_ptr<int>>> vs;
+        for(int i = 0; i<meter.runs(); i++) vs.push_back(make_filled<std::vector<std::unique_ptr<int>>>(make));
+        meter.measure([&](int i) {
+            auto& v = vs[i];
+            auto new_end = std::remove_if(v.begin(), v.end(), odd);
+            size_t removed = static_cast<size_t>(v.end() - new_end);
+            v.erase(new_end, v.end());
+            return removed;
+        });
+    };
+}
@@ -0,0 +1,78 @@
+/*
+ * pool allocator benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * every thread builds and destroys lots of tiny vectors (1 to 16 elements) with std::allocator (glibc malloc)
+ * or pool_allocator, first on one thread and then on several at once to show how the two scale
+ * MYSTL_BENCH_THREADS sets the largest thread count (default: hardware threads, at least 4)
+ */
+#include "../source/pool_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t vectors_per_thread = 200000;
+
+size_t thread_count()
+{
+    if(const char* env = std::getenv("MYSTL_BENCH_THREADS")) return std::strtoull(env, nullptr, 10);
+    size_t hw = std::thread::hardware_concurrency();
+    return (hw<4)?4:hw;
+}
+
+//builds tiny vectors, a few of them alive at once like the children of tree nodes
+template<typename Vec>
+std::uint64_t tiny_vectors()
+{
+    constexpr size_t live = 64;
+    std::vector<Vec> slots(live);
+    std::uint64_t sum = 0;
+    for(size_t i = 0; i<vectors_per_thread; i++)
+    {
+        Vec& v = slots[i % live];
+        sum += v.size();
+        v = Vec();
+        size_t n = 1 + (i * 7) % 16;
+        for(size_t j = 0; j<n; j++) v.push_back(static_cast<std::uint32_t>(i + j));
+    }
+    return sum;
+}
+
+//runs worker on threads threads at once, returns the combined result
+template<typename Worker>
+std::uint64_t run_threads(size_t threads, Worker worker)
+{
+    std::vector<std::uint64_t> results(threads);
+    std::vector<std::thread> pool;
+    for(size_t t = 0; t<threads; t++) pool.emplace_back([&results, t, worker]{ results[t] = worker(); });
+    std::uint64_t sum = 0;
+    for(size_t t = 0; t<threads; t++)
+    {
+        pool[t].join();
+        sum += results[t];
+    }
+    return sum;
+}
+
+}
+
+TEST_CASE("bench pool tiny vectors", "[benchmark]") {
+    using heap_vec = mystl::my_vector<std::uint32_t>;
+    using pool_vec = mystl::my_vector<std::uint32_t, mystl::pool_allocator<std::uint32_t>>;
+    size_t most = thread_count();
+    std::cout << "vectors per thread: " << vectors_per_thread << "\n";
+
+    for(size_t threads = 1; threads<=most; threads *= 2)
+    {
+        std::string suffix = ", " + std::to_string(threads) + " threads";
+        BENCHMARK("malloc" + suffix) { return run_threads(threads, tiny_vectors<heap_vec>); };
+        BENCHMARK("pool_allocator" + suffix) { return run_threads(threads, tiny_vectors<pool_vec>); };
+    }
+}
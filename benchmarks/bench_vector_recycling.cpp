@@ -0,0 +1,72 @@
+/*
+ * recycling allocator benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * a worker keeps building vectors of similar sizes and throws them away, like one batch per request
+ * the vectors are reserved and filled in one go, so the time goes into getting the storage and not into push_back
+ * glibc raises its mmap threshold after the first free of a mapped block (up to 32 MiB), so vectors of a few MiB
+ * already get warm heap memory from malloc, vectors over 32 MiB are mapped, faulted in and unmapped on every use
+ * the hit rate and bytes cached of the recycling cache are printed first
+ */
+#include "../source/recycling_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <iostream>
+
+namespace
+{
+
+using plain = mystl::my_vector<std::uint32_t>;
+using recycled = mystl::my_vector<std::uint32_t, mystl::recycling_allocator<std::uint32_t>>;
+
+//rounds vectors of min_bytes up to min_bytes + spread_bytes
+template<typename Vec>
+std::uint64_t build_batches(size_t rounds, size_t min_bytes, size_t spread_bytes)
+{
+    std::uint64_t sum = 0;
+    for(size_t r = 0; r<rounds; r++)
+    {
+        Vec v;
+        size_t n = (min_bytes + (r * 40503u) % spread_bytes) / sizeof(std::uint32_t);
+        v.reserve(n);
+        std::uint32_t* dest = v.uninitialized_append(n);
+        for(size_t i = 0; i<n; i++) dest[i] = static_cast<std::uint32_t>(i ^ r);
+        sum += v[n / 2];
+    }
+    return sum;
+}
+
+void print_stats()
+{
+    mystl::recycling_stats stats = mystl::recycling_allocator<std::uint32_t>::stats();
+    std::cout << "recycling cache: hit rate " << stats.hit_rate() * 100.0 << "%, "
+              << (stats.bytes_cached >> 20) << " MiB cached\n";
+}
+
+}
+
+TEST_CASE("bench recycling few MiB", "[benchmark]") {
+    constexpr size_t rounds = 200;
+    constexpr size_t min_bytes = size_t(256) << 10;
+    constexpr size_t spread_bytes = size_t(4) << 20;
+    mystl::recycling_allocator<std::uint32_t>::trim();
+    mystl::recycling_allocator<std::uint32_t>::set_cache_limit(size_t(64) << 20);
+    build_batches<recycled>(rounds, min_bytes, spread_bytes);
+    print_stats();
+
+    BENCHMARK("std::allocator") { return build_batches<plain>(rounds, min_bytes, spread_bytes); };
+    BENCHMARK("recycling_allocator") { return build_batches<recycled>(rounds, min_bytes, spread_bytes); };
+}
+
+TEST_CASE("bench recycling over the mmap threshold", "[benchmark]") {
+    constexpr size_t rounds = 20;
+    constexpr size_t min_bytes = size_t(33) << 20;
+    constexpr size_t spread_bytes = size_t(24) << 20;
+    mystl::recycling_allocator<std::uint32_t>::trim();
+    mystl::recycling_allocator<std::uint32_t>::set_cache_limit(size_t(256) << 20);
+    build_batches<recycled>(rounds, min_bytes, spread_bytes);
+    print_stats();
+
+    BENCHMARK("std::allocator") { return build_batches<plain>(rounds, min_bytes, spread_bytes); };
+    BENCHMARK("recycling_allocator") { return build_batches<recycled>(rounds, min_bytes, spread_bytes); };
+}
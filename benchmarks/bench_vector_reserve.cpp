@@ -0,0 +1,134 @@
+/*
+ * growth benchmarks for my_vector::reserve
+ * build in Release and run the executable directly, these are not part of ctest
+ */
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t element_count = 1 << 22;
+
+//16 byte pod, takes the memcpy path
+struct pod16
+{
+    std::uint64_t key;
+    double value;
+};
+
+//same layout, but the user provided move constructor forces the per-element loop
+struct loop16
+{
+    std::uint64_t key;
+    double value;
+
+    loop16(std::uint64_t k, double v): key(k), value(v) {}
+    loop16(const loop16& other): key(other.key), value(other.value) {}
+    loop16(loop16&& other) noexcept: key(other.key), value(other.value) {}
+};
+
+template<typename Vec, typename Elem>
+size_t fill(Vec& v)
+{
+    for(size_t i = 0; i<element_count; i++)
+    {
+        v.push_back(Elem{i, static_cast<double>(i)});
+    }
+    return v.size();
+}
+
+}
+
+TEST_CASE("bench reserve relocation", "[benchmark]") {
+    BENCHMARK("my_vector<pod16> push_back growth (memcpy)") {
+        mystl::my_vector<pod16> v;
+        return fill<mystl::my_vector<pod16>, pod16>(v);
+    };
+    BENCHMARK("my_vector<loop16> push_back growth (per-element loop)") {
+        mystl::my_vector<loop16> v;
+        return fill<mystl::my_vector<loop16>, loop16>(v);
+    };
+    BENCHMARK("std::vector<pod16> push_back growth") {
+        std::vector<pod16> v;
+        return fill<std::vector<pod16>, pod16>(v);
+    };
+
+    BENCHMARK_ADVANCED("my_vector<pod16> single reserve of a full vector (memcpy)")(Catch::Benchmark::Chronometer meter) {
+        std::vector<mystl::my_vector<pod16>> vs(meter.runs());
+        for(auto& v : vs)
+        {
+            v.reserve(element_count);
+            fill<mystl::my_vector<pod16>, pod16>(v);
+        }
+        meter.measure([&](int i) { vs[i].reserve(element_count * 2); return vs[i].capacity(); });
+    };
+    BENCHMARK_ADVANCED("my_vector<loop16> single reserve of a full vector (per-element loop)")(Catch::Benchmark::Chronometer meter) {
+        std::vector<mystl::my_vector<loop16>> vs(meter.runs());
+        for(auto& v : vs)
+        {
+            v.reserve(element_count);
+            fill<mystl::my_vector<loop16>, loop16>(v);
+        }
+        meter.measure([&](int i) { vs[i].reserve(element_count * 2); return vs[i].capacity(); });
+    };
+}
+
+TEST_CASE("bench nested vector growth", "[benchmark]") {
+    constexpr size_t outer_count = 1000000;
+
+    BENCHMARK("my_vector<my_vector<int>> push_back growth (trivially relocatable)") {
+        mystl::my_vector<mystl::my_vector<int>> outer;
+        for(size_t i = 0; i<outer_count; i++)
+        {
+            outer.push_back(mystl::my_vector<int>());
+        }
+        return outer.size();
+    };
+    BENCHMARK("std::vector<std::vector<int>> push_back growth") {
+        std::vector<std::vector<int>> outer;
+        for(size_t i = 0; i<outer_count; i++)
+        {
+            outer.push_back(std::vector<int>());
+        }
+        return outer.size();
+    };
+}
+
+namespace
+{
+
+//my_vector<int> with a move constructor that isnt noexcept -> std::vector deep copies it when growing
+struct maybe_throwing_move : mystl::my_vector<int>
+{
+    maybe_throwing_move() = default;
+    maybe_throwing_move(const maybe_throwing_move&) = default;
+    maybe_throwing_move(maybe_throwing_move&& other) noexcept(false): mystl::my_vector<int>(std::move(other)) {}
+};
+
+template<typename Inner>
+size_t fill_std_outer(size_t outer_count)
+{
+    std::vector<Inner> outer;
+    for(size_t i = 0; i<outer_count; i++)
+    {
+        outer.emplace_back();
+        outer.back().resize(16);
+    }
+    return outer.size();
+}
+
+}
+
+TEST_CASE("bench std::vector of my_vector growth", "[benchmark]") {
+    constexpr size_t outer_count = 200000;
+
+    BENCHMARK("std::vector<my_vector<int>> growth (noexcept move)") {
+        return fill_std_outer<mystl::my_vector<int>>(outer_count);
+    };
+    BENCHMARK("std::vector<maybe_throwing_move> growth (deep copies)") {
+        return fill_std_outer<maybe_throwing_move>(outer_count);
+    };
+}
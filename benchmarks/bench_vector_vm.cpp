@@ -0,0 +1,80 @@
+/*
+ * virtual memory reserved vector benchmarks
+ * build in Release and run the executable directly, these are not part of ctest
+ * appends to an append only log with the doubling my_vector and with vm_vector
+ * the latency of every batch of 4096 push_backs is recorded and the percentiles are printed,
+ * the doubling vector shows its copy spikes in the tail, vm_vector only commits pages
+ * MYSTL_BENCH_VM_MB sets the log size in MiB (default 512)
+ */
+#include "../source/vm_vector.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+constexpr size_t batch = 4096;
+
+size_t element_count()
+{
+    size_t mb = 512;
+    if(const char* env = std::getenv("MYSTL_BENCH_VM_MB")) mb = std::strtoull(env, nullptr, 10);
+    return (mb << 20) / sizeof(std::uint64_t);
+}
+
+template<typename Vec>
+size_t append(Vec& v, size_t n)
+{
+    for(size_t i = 0; i<n; i++) v.push_back(static_cast<std::uint64_t>(i));
+    return v.size();
+}
+
+//nanoseconds of every batch of push_backs into a fresh vector
+template<typename Vec>
+std::vector<double> batch_latencies(Vec& v, size_t n)
+{
+    std::vector<double> result;
+    result.reserve(n / batch + 1);
+    for(size_t i = 0; i<n; i += batch)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for(size_t j = i; j<i + batch && j<n; j++) v.push_back(static_cast<std::uint64_t>(j));
+        auto stop = std::chrono::steady_clock::now();
+        result.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    return result;
+}
+
+template<typename Vec>
+void print_latencies(const char* name, Vec v, size_t n)
+{
+    std::vector<double> ns = batch_latencies(v, n);
+    std::sort(ns.begin(), ns.end());
+    auto pick = [&ns](double q){ return ns[static_cast<size_t>(q * static_cast<double>(ns.size() - 1))] / 1000.0; };
+    std::cout << name << " us per batch of " << batch << ": p50 " << pick(0.5) << ", p99 " << pick(0.99)
+              << ", p99.9 " << pick(0.999) << ", max " << ns.back() / 1000.0 << "\n";
+}
+
+}
+
+TEST_CASE("bench vm append", "[benchmark]") {
+    size_t n = element_count();
+    std::cout << "log size: " << ((n * sizeof(std::uint64_t)) >> 20) << " MiB\n";
+    print_latencies("my_vector", mystl::my_vector<std::uint64_t>(), n);
+    print_latencies("vm_vector", mystl::vm_vector<std::uint64_t>(), n);
+
+    BENCHMARK("my_vector push_back") {
+        mystl::my_vector<std::uint64_t> v;
+        return append(v, n);
+    };
+    BENCHMARK("vm_vector push_back") {
+        mystl::vm_vector<std::uint64_t> v;
+        return append(v, n);
+    };
+}
@@ -0,0 +1,45 @@
+/*
+ * zero initialized allocation benchmarks for my_vector
+ * build in Release and run the executable directly, these are not part of ctest
+ * a 1 GiB counter array is created value initialized and only a few counters get touched,
+ * allocators with allocate_zeroed hand out lazily zeroed pages instead of writing every byte
+ */
+#include "../source/huge_page_allocator.hpp"
+#include "../source/malloc_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+
+namespace
+{
+
+constexpr size_t counter_count = size_t(1) << 28;
+constexpr size_t touched = 10000;
+
+//sparse use of a big counter array, returns a counter so nothing gets optimized away
+template<typename Vec>
+std::uint32_t sparse_counters()
+{
+    Vec counters(counter_count);
+    std::uint64_t state = 12345;
+    for(size_t i = 0; i<touched; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        counters[static_cast<size_t>((state >> 17) % counter_count)]++;
+    }
+    return counters[counter_count / 2];
+}
+
+}
+
+TEST_CASE("bench zeroed counter array", "[benchmark]") {
+    BENCHMARK("std::allocator 1 GiB counters (memset)") {
+        return sparse_counters<mystl::my_vector<std::uint32_t>>();
+    };
+    BENCHMARK("malloc_allocator 1 GiB counters (calloc)") {
+        return sparse_counters<mystl::my_vector<std::uint32_t, mystl::malloc_allocator<std::uint32_t>>>();
+    };
+    BENCHMARK("huge_page_allocator 1 GiB counters (fresh mmap)") {
+        return sparse_counters<mystl::my_vector<std::uint32_t, mystl::huge_page_allocator<std::uint32_t>>>();
+    };
+}
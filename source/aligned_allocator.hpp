@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include "memory.hpp"
+
+namespace mystl
+{
+
+//allocator whose blocks start at a multiple of Align bytes (at least alignof(T))
+//Align = 64 puts begin() on a cache line, so simd kernels can use aligned loads without a peel loop
+//the block size is rounded up to a multiple of the alignment as well and reported through allocate_at_least,
+//so the last vector register worth of elements is always backed by the block
+template<typename T, size_t Align = 64>
+class aligned_allocator
+{
+    static_assert(Align>0 && (Align & (Align - 1))==0, "alignment has to be a power of two");
+
+    public:
+    using value_type = T;
+
+    //alignment of every block
+    static constexpr size_t alignment = (Align>alignof(T))?Align:alignof(T);
+
+    template<typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Align>;
+    };
+
+    aligned_allocator() noexcept = default;
+    template<typename U>
+    aligned_allocator(const aligned_allocator<U, Align>&) noexcept{}
+
+    T* allocate(size_t n)
+    {
+        return allocate_at_least(n).ptr;
+    }
+
+    //storage for at least n elements, count includes the elements that fit in the rounding
+    allocation_result<T*> allocate_at_least(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        size_t bytes = (n * sizeof(T) + alignment - 1) & ~(alignment - 1);
+        void* p = ::operator new(bytes, std::align_val_t(alignment));
+        return {static_cast<T*>(p), bytes / sizeof(T)};
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        ::operator delete(static_cast<void*>(p), std::align_val_t(alignment));
+    }
+
+    size_t max_size() const noexcept
+    {
+        return (static_cast<size_t>(-1) - alignment) / sizeof(T);
+    }
+};
+
+template<typename T, size_t A, typename U, size_t B>
+bool operator == (const aligned_allocator<T, A>&, const aligned_allocator<U, B>&) noexcept
+{
+    return A==B;
+}
+
+template<typename T, size_t A, typename U, size_t B>
+bool operator != (const aligned_allocator<T, A>&, const aligned_allocator<U, B>&) noexcept
+{
+    return A!=B;
+}
+
+}
@@ -0,0 +1,181 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include "memory.hpp"
+
+namespace mystl
+{
+
+//bump pointer arena for data that dies all at once (everything built while handling one request)
+//allocating is a pointer bump, deallocating does nothing, release() frees everything in one go
+//memory comes from an optional initial buffer (a stack array) first, then from chained heap blocks that grow geometrically
+//not thread safe, use one arena per thread or request
+class monotonic_arena
+{
+    public:
+    //heap blocks start at block_size bytes
+    explicit monotonic_arena(size_t block_size = 64 * 1024) noexcept:
+        _initial(nullptr), _initial_size(0), _cur(nullptr), _end(nullptr), _blocks(nullptr),
+        _first_block_size(block_size), _next_block_size(block_size){}
+
+    //uses buffer first, only goes to the heap once it is full
+    monotonic_arena(void* buffer, size_t size, size_t block_size = 64 * 1024) noexcept:
+        _initial(static_cast<char*>(buffer)), _initial_size(size), _cur(static_cast<char*>(buffer)), _end(static_cast<char*>(buffer) + size),
+        _blocks(nullptr), _first_block_size(block_size), _next_block_size(block_size){}
+
+    monotonic_arena(const monotonic_arena&) = delete;
+    monotonic_arena& operator = (const monotonic_arena&) = delete;
+
+    ~monotonic_arena()
+    {
+        release();
+    }
+
+    //bytes of storage aligned to align (a power of two)
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+    {
+        char* p = align_up(_cur, align);
+        //aligning can step past the end of the block
+        if(p==nullptr || p>_end || bytes>static_cast<size_t>(_end - p))
+        {
+            add_block(bytes, align);
+            p = align_up(_cur, align);
+        }
+        _cur = p + bytes;
+        return p;
+    }
+
+    //nothing, the memory comes back with release()
+    void deallocate(void*, size_t) noexcept{}
+
+    //grows the allocation p of old_bytes to new_bytes where it is, only works for the latest allocation
+    //returns false if there is no room behind it
+    bool try_grow(void* p, size_t old_bytes, size_t new_bytes) noexcept
+    {
+        char* c = static_cast<char*>(p);
+        if(c==nullptr || c + old_bytes!=_cur) return false;
+        if(new_bytes>static_cast<size_t>(_end - c)) return false;
+        _cur = c + new_bytes;
+        return true;
+    }
+
+    //frees all heap blocks and starts over at the initial buffer, everything allocated before is gone
+    void release() noexcept
+    {
+        while(_blocks!=nullptr)
+        {
+            block_header* prev = _blocks->prev;
+            ::operator delete(static_cast<void*>(_blocks));
+            _blocks = prev;
+        }
+        _cur = _initial;
+        _end = _initial + _initial_size;
+        _next_block_size = _first_block_size;
+    }
+
+    //bytes left in the current block
+    size_t remaining() const noexcept
+    {
+        return static_cast<size_t>(_end - _cur);
+    }
+
+    private:
+    struct block_header
+    {
+        block_header* prev;
+    };
+
+    static char* align_up(char* p, size_t align) noexcept
+    {
+        if(p==nullptr) return nullptr;
+        std::uintptr_t v = reinterpret_cast<std::uintptr_t>(p);
+        return p + ((align - (v & (align - 1))) & (align - 1));
+    }
+
+    //chains a new heap block that fits bytes at align, the rest of the current block is abandoned
+    void add_block(size_t bytes, size_t align)
+    {
+        size_t needed = sizeof(block_header) + bytes + align;
+        if(needed<bytes) throw std::bad_alloc();
+        size_t size = (_next_block_size>needed)?_next_block_size:needed;
+        block_header* block = static_cast<block_header*>(::operator new(size));
+        block->prev = _blocks;
+        _blocks = block;
+        _cur = reinterpret_cast<char*>(block + 1);
+        _end = reinterpret_cast<char*>(block) + size;
+        //geometric growth -> few blocks even if the arena ends up big
+        _next_block_size = size * 2;
+    }
+
+    char* _initial;
+    size_t _initial_size;
+    //bump pointer and end of the current block
+    char* _cur;
+    char* _end;
+    //newest heap block, each one points to the one before
+    block_header* _blocks;
+    size_t _first_block_size;
+    size_t _next_block_size;
+};
+
+//allocator that takes its memory from a monotonic_arena, the arena has to outlive everything allocated from it
+//deallocate does nothing and the reallocate hook grows the newest block in place, so a vector that is the
+//last thing allocated from the arena grows without copying
+template<typename T>
+class arena_allocator
+{
+    public:
+    using value_type = T;
+
+    explicit arena_allocator(monotonic_arena& arena) noexcept: _arena(&arena){}
+    template<typename U>
+    arena_allocator(const arena_allocator<U>& other) noexcept: _arena(other.arena()){}
+
+    T* allocate(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept{}
+
+    //grows in place if p is the newest allocation of the arena, moves the bytes to a new allocation otherwise
+    allocation_result<T*> reallocate(T* p, size_t old_n, size_t new_n)
+    {
+        if(new_n>max_size()) throw std::bad_alloc();
+        if(_arena->try_grow(p, old_n * sizeof(T), new_n * sizeof(T))) return {p, new_n};
+        T* q = allocate(new_n);
+        size_t keep = (old_n<new_n)?old_n:new_n;
+        if(keep>0) std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), keep * sizeof(T));
+        return {q, new_n};
+    }
+
+    size_t max_size() const noexcept
+    {
+        return static_cast<size_t>(-1) / 2 / sizeof(T);
+    }
+
+    monotonic_arena* arena() const noexcept
+    {
+        return _arena;
+    }
+
+    private:
+    monotonic_arena* _arena;
+};
+
+template<typename T, typename U>
+bool operator == (const arena_allocator<T>& a, const arena_allocator<U>& b) noexcept
+{
+    return a.arena()==b.arena();
+}
+
+template<typename T, typename U>
+bool operator != (const arena_allocator<T>& a, const arena_allocator<U>& b) noexcept
+{
+    return a.arena()!=b.arena();
+}
+
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+//checked iterators for the containers
+//off by default -> iterators are raw pointers, define MYSTL_CHECKED_ITERATORS to 1 to turn them on
+#ifndef MYSTL_CHECKED_ITERATORS
+    #define MYSTL_CHECKED_ITERATORS 0
+#endif
+
+namespace mystl
+{
+
+namespace detail
+{
+
+//random access iterator that remembers its container and the generation of the container when it was made
+//containers bump their generation whenever all iterators become invalid (new storage, clear),
+//any use of an older iterator throws std::logic_error instead of touching freed memory
+//dereferencing also checks the position against the current elements, which catches iterators to erased
+//or popped elements even though the storage didnt change
+//Owner has to befriend this class and provide _data, _size and _generation
+template<typename T, typename Owner>
+class checked_iterator
+{
+    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    checked_iterator() noexcept: _ptr(nullptr), _owner(nullptr), _generation(0){}
+    checked_iterator(T* ptr, const Owner* owner) noexcept: _ptr(ptr), _owner(owner), _generation(owner->_generation){}
+
+    //iterator -> const_iterator
+    template<typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    checked_iterator(const checked_iterator<U, Owner>& other) noexcept: _ptr(other._ptr), _owner(other._owner), _generation(other._generation){}
+
+    reference operator * () const
+    {
+        check_element(0);
+        return *_ptr;
+    }
+    pointer operator -> () const
+    {
+        check_element(0);
+        return _ptr;
+    }
+    reference operator [] (difference_type n) const
+    {
+        check_element(n);
+        return _ptr[n];
+    }
+
+    checked_iterator& operator ++ () noexcept{++_ptr; return *this;}
+    checked_iterator& operator -- () noexcept{--_ptr; return *this;}
+    checked_iterator operator ++ (int) noexcept{checked_iterator old(*this); ++_ptr; return old;}
+    checked_iterator operator -- (int) noexcept{checked_iterator old(*this); --_ptr; return old;}
+    checked_iterator& operator += (difference_type n) noexcept{_ptr += n; return *this;}
+    checked_iterator& operator -= (difference_type n) noexcept{_ptr -= n; return *this;}
+    friend checked_iterator operator + (checked_iterator it, difference_type n) noexcept{return it += n;}
+    friend checked_iterator operator + (difference_type n, checked_iterator it) noexcept{return it += n;}
+    friend checked_iterator operator - (checked_iterator it, difference_type n) noexcept{return it -= n;}
+
+    //the pointer after checking the iterator still belongs to owner, containers use it to turn positions into indexes
+    T* base_for(const Owner* owner) const
+    {
+        if(_owner!=owner) throw std::logic_error("iterator belongs to another container");
+        check_generation();
+        return _ptr;
+    }
+
+    //the pointer after checking the iterator is still valid
+    T* base() const
+    {
+        check_generation();
+        return _ptr;
+    }
+
+    private:
+    template<typename U, typename O>
+    friend class checked_iterator;
+
+    void check_generation() const
+    {
+        if(_owner!=nullptr && _generation!=_owner->_generation)
+        {
+            throw std::logic_error("use of an iterator that was invalidated by a reallocation or clear");
+        }
+    }
+
+    void check_element(difference_type n) const
+    {
+        if(_owner==nullptr) throw std::logic_error("dereferenced a singular iterator");
+        check_generation();
+        difference_type id = (_ptr - _owner->_data) + n;
+        if(id<0 || static_cast<size_t>(id)>=_owner->_size)
+        {
+            throw std::logic_error("dereferenced an iterator outside the elements");
+        }
+    }
+
+    T* _ptr;
+    const Owner* _owner;
+    size_t _generation;
+};
+
+//comparisons and differences work between iterators and const_iterators of the same container
+template<typename T, typename U, typename Owner>
+bool operator == (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()==b.base();
+}
+
+template<typename T, typename U, typename Owner>
+bool operator != (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()!=b.base();
+}
+
+template<typename T, typename U, typename Owner>
+bool operator < (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()<b.base();
+}
+
+template<typename T, typename U, typename Owner>
+bool operator > (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()>b.base();
+}
+
+template<typename T, typename U, typename Owner>
+bool operator <= (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()<=b.base();
+}
+
+template<typename T, typename U, typename Owner>
+bool operator >= (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base()>=b.base();
+}
+
+template<typename T, typename U, typename Owner>
+std::ptrdiff_t operator - (const checked_iterator<T, Owner>& a, const checked_iterator<U, Owner>& b)
+{
+    return a.base() - b.base();
+}
+
+}
+
+}
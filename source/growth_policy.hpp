@@ -0,0 +1,110 @@
+#pragma once
+#include <cstddef>
+
+namespace mystl
+{
+
+//growth policies decide the new capacity of a container whose storage is full
+//a policy is a type with
+//  static size_t next_capacity(size_t cap, size_t required, size_t elem_size)
+//that returns a capacity of at least required, cap is the current capacity
+namespace growth
+{
+
+namespace detail
+{
+
+//size of a memory page, the rounding unit of the kernel
+inline constexpr size_t page_size = 4096;
+
+//max of two sizes without pulling in <algorithm>
+constexpr size_t max_size(size_t a, size_t b)
+{
+    return (a>b)?a:b;
+}
+
+//rounds bytes up to a multiple of unit (unit has to be a power of two)
+constexpr size_t round_up(size_t bytes, size_t unit)
+{
+    return (bytes + unit - 1) & ~(unit - 1);
+}
+
+//rounds bytes up to the size classes used by malloc implementations like jemalloc/tcmalloc:
+//16 byte steps up to 128 bytes, then 4 classes per power of two, whole pages from 16 KiB on
+constexpr size_t round_to_size_class(size_t bytes)
+{
+    if(bytes<=128) return round_up(bytes==0?1:bytes, 16);
+    if(bytes>=4 * page_size) return round_up(bytes, page_size);
+    //highest power of two below bytes
+    size_t group = 128;
+    while(group * 2<bytes) group *= 2;
+    return round_up(bytes, group / 4);
+}
+
+//turns a byte count back into whole elements, never less than required
+constexpr size_t bytes_to_capacity(size_t bytes, size_t required, size_t elem_size)
+{
+    return max_size(bytes / elem_size, required);
+}
+
+}
+
+//doubles the capacity, fewest reallocations but up to half the block unused
+struct doubling
+{
+    static constexpr size_t next_capacity(size_t cap, size_t required, size_t)
+    {
+        return detail::max_size((cap==0)?1:cap * 2, required);
+    }
+};
+
+//grows by 1.5x, less slack and freed blocks can be reused by later growth steps
+struct one_and_half
+{
+    static constexpr size_t next_capacity(size_t cap, size_t required, size_t)
+    {
+        return detail::max_size(cap + cap / 2 + 1, required);
+    }
+};
+
+//grows by 1.5x and then fills the malloc size class the block lands in anyway
+struct size_class
+{
+    static constexpr size_t next_capacity(size_t cap, size_t required, size_t elem_size)
+    {
+        size_t target = one_and_half::next_capacity(cap, required, elem_size);
+        return detail::bytes_to_capacity(detail::round_to_size_class(target * elem_size), required, elem_size);
+    }
+};
+
+//grows by 1.5x and then fills up the last page of the block
+struct page_rounded
+{
+    static constexpr size_t next_capacity(size_t cap, size_t required, size_t elem_size)
+    {
+        size_t target = one_and_half::next_capacity(cap, required, elem_size);
+        return detail::bytes_to_capacity(detail::round_up(target * elem_size, detail::page_size), required, elem_size);
+    }
+};
+
+//doubles until the block reaches ThresholdBytes, after that grows by a fixed IncrementBytes
+//bounds the slack of huge vectors to one increment instead of half the block
+template<size_t IncrementBytes = (size_t(64) << 20), size_t ThresholdBytes = IncrementBytes>
+struct chunked
+{
+    static_assert(IncrementBytes>0, "chunked growth needs a non-zero increment");
+
+    static constexpr size_t next_capacity(size_t cap, size_t required, size_t elem_size)
+    {
+        if(cap * elem_size<ThresholdBytes)
+        {
+            return doubling::next_capacity(cap, required, elem_size);
+        }
+        size_t increment = detail::max_size(IncrementBytes / elem_size, 1);
+        return detail::max_size(cap + increment, required);
+    }
+};
+
+}
+
+}
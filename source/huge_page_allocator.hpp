@@ -0,0 +1,239 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include "memory.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define MYSTL_HAS_MMAP 1
+#else
+#define MYSTL_HAS_MMAP 0
+#endif
+
+namespace mystl
+{
+
+namespace detail
+{
+
+//size and alignment of a transparent huge page on x86-64 and most aarch64 kernels
+inline constexpr size_t huge_page_size = size_t(2) << 20;
+
+//maps bytes (a multiple of huge_page_size) at a huge_page_size aligned address and asks for huge pages
+//returns nullptr if the mapping fails
+inline void* map_huge(size_t bytes) noexcept
+{
+#if MYSTL_HAS_MMAP
+    //mmap only aligns to the base page -> map one huge page more and cut off what sticks out on both ends
+    size_t span = bytes + huge_page_size;
+    void* raw = ::mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(raw==MAP_FAILED) return nullptr;
+    char* first = static_cast<char*>(raw);
+    char* aligned = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(first) + huge_page_size - 1) & ~(huge_page_size - 1));
+    size_t front = static_cast<size_t>(aligned - first);
+    if(front>0) ::munmap(first, front);
+    size_t back = span - front - bytes;
+    if(back>0) ::munmap(aligned + bytes, back);
+#ifdef MADV_HUGEPAGE
+    //only a hint, with THP set to never (or no THP in the kernel) this fails and the mapping keeps base pages
+    ::madvise(aligned, bytes, MADV_HUGEPAGE);
+#endif
+    return aligned;
+#else
+    (void)bytes;
+    return nullptr;
+#endif
+}
+
+//unmaps a block from map_huge
+inline void unmap_huge(void* p, size_t bytes) noexcept
+{
+#if MYSTL_HAS_MMAP
+    ::munmap(p, bytes);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+//resizes the block p of old_bytes from map_huge to new_bytes by moving page table entries instead of the data
+//the result is huge_page_size aligned again, nullptr if it didnt work (p is still valid then)
+inline void* remap_huge(void* p, size_t old_bytes, size_t new_bytes) noexcept
+{
+#if defined(__linux__)
+    //first try to extend or shrink the mapping where it is
+    void* q = ::mremap(p, old_bytes, new_bytes, 0);
+    if(q!=MAP_FAILED) return q;
+    //no room behind it -> reserve an aligned range and move the pages over, replacing that range
+    void* target = map_huge(new_bytes);
+    if(target==nullptr) return nullptr;
+    q = ::mremap(p, old_bytes, new_bytes, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+    if(q==MAP_FAILED)
+    {
+        unmap_huge(target, new_bytes);
+        return nullptr;
+    }
+#ifdef MADV_HUGEPAGE
+    //the moved range keeps the old flags, the part that grew gets them here
+    ::madvise(q, new_bytes, MADV_HUGEPAGE);
+#endif
+    return q;
+#else
+    (void)p;
+    (void)old_bytes;
+    (void)new_bytes;
+    return nullptr;
+#endif
+}
+
+//counters behind huge_page_allocator::stats
+inline std::atomic<size_t> huge_page_remaps{0};
+inline std::atomic<size_t> huge_page_bytes_not_copied{0};
+
+}
+
+//what the reallocate hook of huge_page_allocator saved, over all instances and threads
+struct huge_page_stats
+{
+    //blocks resized with mremap
+    size_t remaps;
+    //bytes that moved with the page tables instead of being copied
+    size_t bytes_not_copied;
+};
+
+//allocator for very large buffers, blocks of at least Threshold bytes are mapped with mmap at 2 MiB alignment
+//and marked with MADV_HUGEPAGE, so the kernel can back them with transparent huge pages -> far fewer TLB misses
+//when multi GB vectors are iterated or accessed randomly
+//smaller blocks, and every block on platforms without mmap, come from aligned operator new
+//mapped blocks are rounded up to whole huge pages, allocate_at_least reports the extra elements
+//the reallocate hook grows mapped blocks with mremap on linux -> containers of trivially relocatable types
+//dont copy a single byte and never need the old and new block at the same time
+template<typename T, size_t Threshold = detail::huge_page_size>
+class huge_page_allocator
+{
+    public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = huge_page_allocator<U, Threshold>;
+    };
+
+    huge_page_allocator() noexcept = default;
+    template<typename U>
+    huge_page_allocator(const huge_page_allocator<U, Threshold>&) noexcept{}
+
+    T* allocate(size_t n)
+    {
+        return allocate_at_least(n).ptr;
+    }
+
+    //storage for at least n elements, count includes the elements that fit in the huge page rounding
+    allocation_result<T*> allocate_at_least(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        size_t bytes = n * sizeof(T);
+        if(!is_mapped(bytes))
+        {
+            return {static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T)))), n};
+        }
+        size_t mapped = mapped_bytes(bytes);
+        void* p = detail::map_huge(mapped);
+        if(p==nullptr) throw std::bad_alloc();
+        return {static_cast<T*>(p), mapped / sizeof(T)};
+    }
+
+    //storage for at least n elements that are all bits zero
+    //fresh mappings are zero already and only get backed by memory when touched, heap blocks are cleared
+    allocation_result<T*> allocate_zeroed(size_t n)
+    {
+        allocation_result<T*> result = allocate_at_least(n);
+        if(!is_mapped(n * sizeof(T))) std::memset(static_cast<void*>(result.ptr), 0, n * sizeof(T));
+        return result;
+    }
+
+    //n is the count from allocate or allocate_at_least, it tells mapped and new blocks apart
+    void deallocate(T* p, size_t n) noexcept
+    {
+        size_t bytes = n * sizeof(T);
+        if(is_mapped(bytes))
+        {
+            detail::unmap_huge(p, mapped_bytes(bytes));
+        }
+        else
+        {
+            ::operator delete(static_cast<void*>(p), std::align_val_t(alignof(T)));
+        }
+    }
+
+    //resizes the block p of old_n elements to hold new_n, its bytes move along
+    //only valid for trivially relocatable T, containers only call it for those
+    //if it fails the old block is untouched
+    allocation_result<T*> reallocate(T* p, size_t old_n, size_t new_n)
+    {
+        if(p==nullptr) return allocate_at_least(new_n);
+        if(new_n>max_size()) throw std::bad_alloc();
+        size_t old_bytes = old_n * sizeof(T);
+        size_t new_bytes = new_n * sizeof(T);
+        if(is_mapped(old_bytes) && is_mapped(new_bytes))
+        {
+            size_t old_mapped = mapped_bytes(old_bytes);
+            size_t new_mapped = mapped_bytes(new_bytes);
+            if(old_mapped==new_mapped) return {p, new_mapped / sizeof(T)};
+            void* q = detail::remap_huge(p, old_mapped, new_mapped);
+            if(q!=nullptr)
+            {
+                detail::huge_page_remaps.fetch_add(1, std::memory_order_relaxed);
+                detail::huge_page_bytes_not_copied.fetch_add((old_mapped<new_mapped)?old_mapped:new_mapped, std::memory_order_relaxed);
+                return {static_cast<T*>(q), new_mapped / sizeof(T)};
+            }
+        }
+        //heap blocks, crossing the threshold or no mremap -> new block and one copy
+        allocation_result<T*> result = allocate_at_least(new_n);
+        size_t keep = (old_n<result.count)?old_n:result.count;
+        std::memcpy(static_cast<void*>(result.ptr), static_cast<const void*>(p), keep * sizeof(T));
+        deallocate(p, old_n);
+        return result;
+    }
+
+    //what the reallocate hook saved so far, over all huge_page_allocators
+    static huge_page_stats stats() noexcept
+    {
+        return {detail::huge_page_remaps.load(std::memory_order_relaxed),
+                detail::huge_page_bytes_not_copied.load(std::memory_order_relaxed)};
+    }
+
+    size_t max_size() const noexcept
+    {
+        return (static_cast<size_t>(-1) - 2 * detail::huge_page_size) / sizeof(T);
+    }
+
+    private:
+    static constexpr bool is_mapped(size_t bytes) noexcept
+    {
+        return MYSTL_HAS_MMAP && bytes>=Threshold;
+    }
+
+    static constexpr size_t mapped_bytes(size_t bytes) noexcept
+    {
+        return (bytes + detail::huge_page_size - 1) & ~(detail::huge_page_size - 1);
+    }
+};
+
+template<typename T, size_t A, typename U, size_t B>
+bool operator == (const huge_page_allocator<T, A>&, const huge_page_allocator<U, B>&) noexcept
+{
+    return A==B;
+}
+
+template<typename T, size_t A, typename U, size_t B>
+bool operator != (const huge_page_allocator<T, A>&, const huge_page_allocator<U, B>&) noexcept
+{
+    return A!=B;
+}
+
+}
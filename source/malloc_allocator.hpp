@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "memory.hpp"
+
+namespace mystl
+{
+
+//allocator on top of malloc/realloc/free
+//malloc rounds every block up to a size class -> allocate_at_least reports what the block really holds,
+//and the reallocate hook lets containers of trivially relocatable types grow in place with realloc
+template<typename T>
+class malloc_allocator
+{
+    //realloc keeps no alignment stronger than that of malloc
+    static_assert(alignof(T)<=alignof(std::max_align_t), "malloc only aligns to max_align_t, use aligned_allocator for over-aligned types");
+
+    public:
+    using value_type = T;
+
+    malloc_allocator() noexcept = default;
+    template<typename U>
+    malloc_allocator(const malloc_allocator<U>&) noexcept{}
+
+    T* allocate(size_t n)
+    {
+        return allocate_at_least(n).ptr;
+    }
+
+    //storage for at least n elements, count is how many the block can really hold
+    allocation_result<T*> allocate_at_least(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        void* p = std::malloc(n * sizeof(T));
+        if(p==nullptr) throw std::bad_alloc();
+        return claim_usable(p, n * sizeof(T));
+    }
+
+    //storage for at least n elements that are all bits zero
+    //calloc gets big blocks straight from mmap and skips the memset, the pages are zeroed when first touched
+    allocation_result<T*> allocate_zeroed(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        void* p = std::calloc(n, sizeof(T));
+        if(p==nullptr) throw std::bad_alloc();
+        return claim_usable(p, n * sizeof(T));
+    }
+
+    //resizes the block at p to new_n elements, the bytes of the old block move along if it cant grow in place
+    //if it fails the old block is untouched
+    allocation_result<T*> reallocate(T* p, size_t, size_t new_n)
+    {
+        if(new_n>max_size()) throw std::bad_alloc();
+        void* q = std::realloc(static_cast<void*>(p), new_n * sizeof(T));
+        if(q==nullptr) throw std::bad_alloc();
+        return claim_usable(q, new_n * sizeof(T));
+    }
+
+    void deallocate(T* p, size_t) noexcept
+    {
+        std::free(static_cast<void*>(p));
+    }
+
+    size_t max_size() const noexcept
+    {
+        return static_cast<size_t>(-1) / sizeof(T);
+    }
+
+    private:
+    //block p of requested bytes as an allocation of every element it really holds
+    //the rounding slack only belongs to us after a realloc to the usable size, which stays in place,
+    //otherwise the compiler and _FORTIFY_SOURCE treat writes past requested as overflows
+    static allocation_result<T*> claim_usable(void* p, size_t requested) noexcept
+    {
+        size_t usable = detail::malloc_usable_bytes(p, requested) / sizeof(T) * sizeof(T);
+        if(usable>requested)
+        {
+            void* q = std::realloc(p, usable);
+            if(q!=nullptr) return {static_cast<T*>(q), usable / sizeof(T)};
+        }
+        return {static_cast<T*>(p), requested / sizeof(T)};
+    }
+};
+
+//every malloc_allocator frees what any other one allocated
+template<typename T, typename U>
+bool operator == (const malloc_allocator<T>&, const malloc_allocator<U>&) noexcept
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator != (const malloc_allocator<T>&, const malloc_allocator<U>&) noexcept
+{
+    return false;
+}
+
+}
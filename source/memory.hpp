@@ -0,0 +1,135 @@
+#pragma once
+#include <cstddef>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__APPLE__)
+#include <malloc/malloc.h>
+#elif defined(__GLIBC__) || defined(__linux__) || defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace mystl
+{
+
+//what the allocate_at_least and reallocate hooks of an allocator return
+//count is the number of elements the block really holds, at least the number asked for
+template<typename Pointer>
+struct allocation_result
+{
+    Pointer ptr;
+    size_t count;
+};
+
+namespace detail
+{
+
+//keeps the allocator of a container
+//derives from it when it is empty, so a stateless allocator takes no space (empty base optimization)
+template<typename Alloc, bool = std::is_empty_v<Alloc> && !std::is_final_v<Alloc>>
+class allocator_holder : private Alloc
+{
+    public:
+    allocator_holder() = default;
+    explicit allocator_holder(const Alloc& a) noexcept: Alloc(a){}
+
+    Alloc& alloc() noexcept{return *this;}
+    const Alloc& alloc() const noexcept{return *this;}
+};
+
+//stateful or final allocators are stored as a plain member
+template<typename Alloc>
+class allocator_holder<Alloc, false>
+{
+    public:
+    allocator_holder() = default;
+    explicit allocator_holder(const Alloc& a) noexcept: _alloc(a){}
+
+    Alloc& alloc() noexcept{return _alloc;}
+    const Alloc& alloc() const noexcept{return _alloc;}
+
+    private:
+    Alloc _alloc;
+};
+
+//optional allocator hooks, containers use them when they are there and fall back to allocator_traits otherwise
+
+//allocation_result<pointer> allocate_at_least(size_t n) -> may hand out a bigger block than asked for
+template<typename Alloc, typename = void>
+struct has_allocate_at_least : std::false_type {};
+
+template<typename Alloc>
+struct has_allocate_at_least<Alloc, std::void_t<decltype(std::declval<Alloc&>().allocate_at_least(size_t{}))>> : std::true_type {};
+
+template<typename Alloc>
+inline constexpr bool has_allocate_at_least_v = has_allocate_at_least<Alloc>::value;
+
+//allocation_result<pointer> reallocate(pointer p, size_t old_n, size_t new_n) -> resizes the block at p,
+//moving its bytes if it has to, and leaves it untouched if it throws
+template<typename Alloc, typename = void>
+struct has_reallocate : std::false_type {};
+
+template<typename Alloc>
+struct has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+    std::declval<typename std::allocator_traits<Alloc>::pointer>(), size_t{}, size_t{}))>> : std::true_type {};
+
+template<typename Alloc>
+inline constexpr bool has_reallocate_v = has_reallocate<Alloc>::value;
+
+//allocation_result<pointer> allocate_zeroed(size_t n) -> like allocate_at_least, but the first n elements are all bits zero,
+//ideally from pages the kernel zeroes lazily on first touch
+template<typename Alloc, typename = void>
+struct has_allocate_zeroed : std::false_type {};
+
+template<typename Alloc>
+struct has_allocate_zeroed<Alloc, std::void_t<decltype(std::declval<Alloc&>().allocate_zeroed(size_t{}))>> : std::true_type {};
+
+template<typename Alloc>
+inline constexpr bool has_allocate_zeroed_v = has_allocate_zeroed<Alloc>::value;
+
+//true if allocator_traits construct and destroy are plain placement new and destructor calls,
+//then copies of trivial types may be done with memcpy and trivial destructors skipped
+template<typename Alloc, typename = void>
+struct has_member_construct : std::false_type {};
+
+template<typename Alloc>
+struct has_member_construct<Alloc, std::void_t<decltype(std::declval<Alloc&>().construct(
+    std::declval<typename Alloc::value_type*>(), std::declval<const typename Alloc::value_type&>()))>> : std::true_type {};
+
+template<typename Alloc, typename = void>
+struct has_member_destroy : std::false_type {};
+
+template<typename Alloc>
+struct has_member_destroy<Alloc, std::void_t<decltype(std::declval<Alloc&>().destroy(
+    std::declval<typename Alloc::value_type*>()))>> : std::true_type {};
+
+template<typename Alloc>
+inline constexpr bool constructs_in_place_v = !has_member_construct<Alloc>::value && !has_member_destroy<Alloc>::value;
+
+//std::allocator still has (deprecated) construct and destroy members in C++17, they do exactly that
+template<typename U>
+inline constexpr bool constructs_in_place_v<std::allocator<U>> = true;
+
+//bytes the malloc block at p can really hold, requested is what was asked for
+//malloc rounds every request up to a size class, containers can use the difference for free
+//falls back to requested where the platform has no way to ask
+inline size_t malloc_usable_bytes(void* p, size_t requested) noexcept
+{
+    if(p==nullptr) return 0;
+#if defined(__APPLE__)
+    size_t usable = malloc_size(p);
+#elif defined(__GLIBC__) || defined(__linux__)
+    size_t usable = malloc_usable_size(p);
+#elif defined(_WIN32)
+    size_t usable = _msize(p);
+#else
+    size_t usable = requested;
+#endif
+    return (usable>requested)?usable:requested;
+}
+
+}
+
+}
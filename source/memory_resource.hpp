@@ -0,0 +1,399 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include "arena.hpp"
+#include "pool_allocator.hpp"
+#include "vector.hpp"
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+//memory_resource is std::pmr::memory_resource where the standard library has it, so resources mix freely
+//with std::pmr containers, otherwise an own class with the same interface
+//define MYSTL_HAS_STD_PMR to 0 to use the own one anyway
+#ifndef MYSTL_HAS_STD_PMR
+    #if defined(__cpp_lib_memory_resource)
+        #define MYSTL_HAS_STD_PMR 1
+    #else
+        #define MYSTL_HAS_STD_PMR 0
+    #endif
+#endif
+
+namespace mystl
+{
+
+//runtime selected memory strategies, containers only see a memory_resource* and the type stays the same
+//for every strategy (arena per request, pool per worker, heap otherwise)
+namespace pmr
+{
+
+#if MYSTL_HAS_STD_PMR
+
+using memory_resource = std::pmr::memory_resource;
+
+inline memory_resource* new_delete_resource() noexcept
+{
+    return std::pmr::new_delete_resource();
+}
+
+inline memory_resource* null_memory_resource() noexcept
+{
+    return std::pmr::null_memory_resource();
+}
+
+inline memory_resource* get_default_resource() noexcept
+{
+    return std::pmr::get_default_resource();
+}
+
+inline memory_resource* set_default_resource(memory_resource* r) noexcept
+{
+    return std::pmr::set_default_resource(r);
+}
+
+#else
+
+//same interface as std::pmr::memory_resource
+class memory_resource
+{
+    public:
+    virtual ~memory_resource() = default;
+
+    void* allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+    {
+        return do_allocate(bytes, align);
+    }
+
+    void deallocate(void* p, size_t bytes, size_t align = alignof(std::max_align_t))
+    {
+        do_deallocate(p, bytes, align);
+    }
+
+    bool is_equal(const memory_resource& other) const noexcept
+    {
+        return do_is_equal(other);
+    }
+
+    private:
+    virtual void* do_allocate(size_t bytes, size_t align) = 0;
+    virtual void do_deallocate(void* p, size_t bytes, size_t align) = 0;
+    virtual bool do_is_equal(const memory_resource& other) const noexcept = 0;
+};
+
+inline bool operator == (const memory_resource& a, const memory_resource& b) noexcept
+{
+    return &a==&b || a.is_equal(b);
+}
+
+inline bool operator != (const memory_resource& a, const memory_resource& b) noexcept
+{
+    return !(a==b);
+}
+
+namespace detail
+{
+
+class new_delete_resource_impl : public memory_resource
+{
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        return ::operator new(bytes, std::align_val_t(align));
+    }
+
+    void do_deallocate(void* p, size_t, size_t align) override
+    {
+        ::operator delete(p, std::align_val_t(align));
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this==&other;
+    }
+};
+
+class null_resource_impl : public memory_resource
+{
+    void* do_allocate(size_t, size_t) override
+    {
+        throw std::bad_alloc();
+    }
+
+    void do_deallocate(void*, size_t, size_t) override{}
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this==&other;
+    }
+};
+
+//never destroyed, containers can still free into it during static destruction
+inline memory_resource* new_delete_instance() noexcept
+{
+    static memory_resource* r = new new_delete_resource_impl();
+    return r;
+}
+
+inline std::atomic<memory_resource*>& default_resource() noexcept
+{
+    static std::atomic<memory_resource*> r{new_delete_instance()};
+    return r;
+}
+
+}
+
+inline memory_resource* new_delete_resource() noexcept
+{
+    return detail::new_delete_instance();
+}
+
+inline memory_resource* null_memory_resource() noexcept
+{
+    static detail::null_resource_impl r;
+    return &r;
+}
+
+inline memory_resource* get_default_resource() noexcept
+{
+    return detail::default_resource().load();
+}
+
+//nullptr resets to new_delete_resource, returns the previous default
+inline memory_resource* set_default_resource(memory_resource* r) noexcept
+{
+    return detail::default_resource().exchange((r!=nullptr)?r:new_delete_resource());
+}
+
+#endif
+
+//allocator that forwards to a memory_resource, the resource has to outlive everything allocated from it
+//unlike std::pmr::polymorphic_allocator it has no construct member, so my_vector keeps its memcpy and
+//skipped destructor fast paths
+//like the std one it never propagates and copies of containers get the default resource
+template<typename T>
+class polymorphic_allocator
+{
+    public:
+    using value_type = T;
+
+    polymorphic_allocator() noexcept: _resource(get_default_resource()){}
+    polymorphic_allocator(memory_resource* r) noexcept: _resource(r){}
+    polymorphic_allocator(const polymorphic_allocator&) = default;
+    template<typename U>
+    polymorphic_allocator(const polymorphic_allocator<U>& other) noexcept: _resource(other.resource()){}
+
+    //containers never reassign it, a container is bound to one resource for its whole life
+    polymorphic_allocator& operator = (const polymorphic_allocator&) = delete;
+
+    T* allocate(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        return static_cast<T*>(_resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        _resource->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    polymorphic_allocator select_on_container_copy_construction() const noexcept
+    {
+        return polymorphic_allocator();
+    }
+
+    size_t max_size() const noexcept
+    {
+        return static_cast<size_t>(-1) / sizeof(T);
+    }
+
+    memory_resource* resource() const noexcept
+    {
+        return _resource;
+    }
+
+    private:
+    memory_resource* _resource;
+};
+
+template<typename T, typename U>
+bool operator == (const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b) noexcept
+{
+    return *a.resource()==*b.resource();
+}
+
+template<typename T, typename U>
+bool operator != (const polymorphic_allocator<T>& a, const polymorphic_allocator<U>& b) noexcept
+{
+    return !(a==b);
+}
+
+//monotonic_arena behind a memory_resource, deallocate does nothing and release() frees everything
+class monotonic_buffer_resource : public memory_resource
+{
+    public:
+    explicit monotonic_buffer_resource(size_t block_size = 64 * 1024) noexcept: _arena(block_size){}
+    //uses buffer first, only goes to the heap once it is full
+    monotonic_buffer_resource(void* buffer, size_t size, size_t block_size = 64 * 1024) noexcept: _arena(buffer, size, block_size){}
+
+    monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+    monotonic_buffer_resource& operator = (const monotonic_buffer_resource&) = delete;
+
+    void release() noexcept
+    {
+        _arena.release();
+    }
+
+    private:
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        return _arena.allocate(bytes, align);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override{}
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this==&other;
+    }
+
+    monotonic_arena _arena;
+};
+
+//pool for one thread, the size classes of pool_allocator but with free lists that belong to this resource
+//blocks over 1 KiB or over max_align_t alignment go to operator new and back with deallocate
+//the pooled memory is carved from 64 KiB slabs, release() and the destructor free all of them at once
+class unsynchronized_pool_resource : public memory_resource
+{
+    public:
+    unsynchronized_pool_resource() noexcept: _heads{}, _cur(nullptr), _end(nullptr), _slabs(nullptr){}
+
+    unsynchronized_pool_resource(const unsynchronized_pool_resource&) = delete;
+    unsynchronized_pool_resource& operator = (const unsynchronized_pool_resource&) = delete;
+
+    ~unsynchronized_pool_resource()
+    {
+        release();
+    }
+
+    //frees every pooled block, even the ones not deallocated yet
+    void release() noexcept
+    {
+        while(_slabs!=nullptr)
+        {
+            slab* prev = _slabs->prev;
+            ::operator delete(static_cast<void*>(_slabs));
+            _slabs = prev;
+        }
+        for(size_t c = 0; c<mystl::detail::pool_class_count; c++) _heads[c] = nullptr;
+        _cur = nullptr;
+        _end = nullptr;
+    }
+
+    private:
+    struct slab
+    {
+        alignas(std::max_align_t) slab* prev;
+    };
+
+    static bool is_pooled(size_t bytes, size_t align) noexcept
+    {
+        return bytes<=mystl::detail::pool_max_block && align<=alignof(std::max_align_t);
+    }
+
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        if(!is_pooled(bytes, align)) return ::operator new(bytes, std::align_val_t(align));
+        size_t c = mystl::detail::pool_class_of(bytes);
+        if(mystl::detail::pool_node* node = _heads[c])
+        {
+            _heads[c] = node->next;
+            return node;
+        }
+        size_t block = mystl::detail::pool_block_size(c);
+        if(static_cast<size_t>(_end - _cur)<block)
+        {
+            //the rest of the old slab is smaller than a block and gets dropped
+            constexpr size_t slab_size = 64 * 1024;
+            slab* s = static_cast<slab*>(::operator new(slab_size));
+            s->prev = _slabs;
+            _slabs = s;
+            _cur = reinterpret_cast<char*>(s + 1);
+            _end = reinterpret_cast<char*>(s) + slab_size;
+        }
+        void* p = _cur;
+        _cur += block;
+        return p;
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t align) override
+    {
+        if(!is_pooled(bytes, align))
+        {
+            ::operator delete(p, std::align_val_t(align));
+            return;
+        }
+        size_t c = mystl::detail::pool_class_of(bytes);
+        mystl::detail::pool_node* node = static_cast<mystl::detail::pool_node*>(p);
+        node->next = _heads[c];
+        _heads[c] = node;
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this==&other;
+    }
+
+    mystl::detail::pool_node* _heads[mystl::detail::pool_class_count];
+    //unused part of the newest slab, shared by all size classes
+    char* _cur;
+    char* _end;
+    //newest slab, each one points to the one before
+    slab* _slabs;
+};
+
+//unsynchronized_pool_resource behind a mutex, for a pool that several threads of a worker share
+class synchronized_pool_resource : public memory_resource
+{
+    public:
+    synchronized_pool_resource() = default;
+
+    synchronized_pool_resource(const synchronized_pool_resource&) = delete;
+    synchronized_pool_resource& operator = (const synchronized_pool_resource&) = delete;
+
+    void release() noexcept
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pool.release();
+    }
+
+    private:
+    void* do_allocate(size_t bytes, size_t align) override
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        return _pool.allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t align) override
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _pool.deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(const memory_resource& other) const noexcept override
+    {
+        return this==&other;
+    }
+
+    std::mutex _lock;
+    unsynchronized_pool_resource _pool;
+};
+
+//my_vector that allocates from a memory_resource chosen at runtime
+template<typename T, typename Growth = growth::doubling>
+using my_vector = mystl::my_vector<T, polymorphic_allocator<T>, Growth>;
+
+}
+
+}
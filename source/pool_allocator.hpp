@@ -0,0 +1,289 @@
+#pragma once
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include "memory.hpp"
+
+namespace mystl
+{
+
+namespace detail
+{
+
+//size classes of the pool, powers of two from 16 to 1024 bytes, bigger blocks go to operator new
+inline constexpr size_t pool_class_count = 7;
+inline constexpr size_t pool_min_block = 16;
+inline constexpr size_t pool_max_block = pool_min_block << (pool_class_count - 1);
+
+constexpr size_t pool_class_of(size_t bytes) noexcept
+{
+    size_t c = 0;
+    size_t block = pool_min_block;
+    while(block<bytes)
+    {
+        block <<= 1;
+        c++;
+    }
+    return c;
+}
+
+constexpr size_t pool_block_size(size_t c) noexcept
+{
+    return pool_min_block << c;
+}
+
+//blocks moved between a thread cache and the depot at once, about 4 KiB worth
+constexpr size_t pool_batch_count(size_t c) noexcept
+{
+    return (pool_block_size(c)>=1024)?4:4096 / pool_block_size(c);
+}
+
+//a free block, next links the blocks of a chain, next_batch links whole batches in the depot
+struct pool_node
+{
+    pool_node* next;
+    pool_node* next_batch;
+};
+
+//shared store behind the thread caches, one lock per size class
+//memory is carved from 64 KiB slabs that are never given back to the system, freed blocks stay in the pool
+class pool_depot
+{
+    public:
+    //never destroyed, threads can flush their caches into it after static destruction started
+    static pool_depot& instance()
+    {
+        static pool_depot* depot = new pool_depot();
+        return *depot;
+    }
+
+    //a chain of exactly pool_batch_count(c) blocks
+    pool_node* take_batch(size_t c)
+    {
+        size_class& sc = _classes[c];
+        size_t count = pool_batch_count(c);
+        std::lock_guard<std::mutex> guard(sc.lock);
+        if(sc.batches!=nullptr)
+        {
+            pool_node* batch = sc.batches;
+            sc.batches = batch->next_batch;
+            return batch;
+        }
+        if(sc.loose_count>=count)
+        {
+            pool_node* first = sc.loose;
+            pool_node* last = first;
+            for(size_t i = 1; i<count; i++) last = last->next;
+            sc.loose = last->next;
+            sc.loose_count -= count;
+            last->next = nullptr;
+            return first;
+        }
+        return carve(sc, c, count);
+    }
+
+    //takes back a chain of exactly pool_batch_count(c) blocks
+    void give_batch(size_t c, pool_node* batch) noexcept
+    {
+        size_class& sc = _classes[c];
+        std::lock_guard<std::mutex> guard(sc.lock);
+        batch->next_batch = sc.batches;
+        sc.batches = batch;
+    }
+
+    //takes back a chain of count blocks, ending in nullptr
+    void give_loose(size_t c, pool_node* first, size_t count) noexcept
+    {
+        pool_node* last = first;
+        while(last->next!=nullptr) last = last->next;
+        size_class& sc = _classes[c];
+        std::lock_guard<std::mutex> guard(sc.lock);
+        last->next = sc.loose;
+        sc.loose = first;
+        sc.loose_count += count;
+    }
+
+    private:
+    pool_depot() = default;
+
+    //own cache line per class, threads refilling different classes dont slow each other down
+    struct alignas(64) size_class
+    {
+        std::mutex lock;
+        //full batches
+        pool_node* batches = nullptr;
+        //single blocks from thread caches that exited
+        pool_node* loose = nullptr;
+        size_t loose_count = 0;
+        //unused part of the newest slab
+        char* cur = nullptr;
+        char* end = nullptr;
+    };
+
+    //cuts a fresh batch from the slab of the class, the lock is held
+    static pool_node* carve(size_class& sc, size_t c, size_t count)
+    {
+        size_t block = pool_block_size(c);
+        if(static_cast<size_t>(sc.end - sc.cur)<block * count)
+        {
+            //whatever is left of the old slab is too small for a batch and gets dropped
+            constexpr size_t slab_size = 64 * 1024;
+            sc.cur = static_cast<char*>(::operator new(slab_size));
+            sc.end = sc.cur + slab_size;
+        }
+        pool_node* first = reinterpret_cast<pool_node*>(sc.cur);
+        for(size_t i = 0; i<count; i++)
+        {
+            pool_node* node = reinterpret_cast<pool_node*>(sc.cur + i * block);
+            node->next = (i + 1<count)?reinterpret_cast<pool_node*>(sc.cur + (i + 1) * block):nullptr;
+        }
+        sc.cur += block * count;
+        return first;
+    }
+
+    size_class _classes[pool_class_count];
+};
+
+//free blocks of one thread, a free list per size class
+//trivial so it needs no guard on access and stays usable while other thread_locals are destroyed
+struct pool_cache
+{
+    pool_node* head[pool_class_count];
+    size_t count[pool_class_count];
+};
+
+inline thread_local pool_cache pool_thread_cache{};
+
+//gives the cache of the thread back to the depot when the thread exits
+//blocks freed after that (from destructors of later thread_locals) stay in the dead cache
+struct pool_cache_flusher
+{
+    ~pool_cache_flusher()
+    {
+        pool_cache& cache = pool_thread_cache;
+        for(size_t c = 0; c<pool_class_count; c++)
+        {
+            if(cache.head[c]!=nullptr) pool_depot::instance().give_loose(c, cache.head[c], cache.count[c]);
+            cache.head[c] = nullptr;
+            cache.count[c] = 0;
+        }
+    }
+};
+
+//registers the flusher of this thread, called whenever a free list goes from empty to non empty
+//so only that slow path pays for the guard
+inline void pool_register_flusher() noexcept
+{
+    static thread_local pool_cache_flusher flusher;
+    (void)flusher;
+}
+
+//the cache of class c is empty -> fetch a batch, returns its first block
+inline pool_node* pool_refill(size_t c)
+{
+    pool_register_flusher();
+    pool_node* batch = pool_depot::instance().take_batch(c);
+    pool_cache& cache = pool_thread_cache;
+    cache.head[c] = batch;
+    cache.count[c] = pool_batch_count(c);
+    return batch;
+}
+
+inline void* pool_allocate(size_t c)
+{
+    pool_cache& cache = pool_thread_cache;
+    pool_node* node = cache.head[c];
+    if(node==nullptr) node = pool_refill(c);
+    cache.head[c] = node->next;
+    cache.count[c]--;
+    return node;
+}
+
+inline void pool_deallocate(void* p, size_t c) noexcept
+{
+    pool_cache& cache = pool_thread_cache;
+    //a thread that only frees needs the flusher as well
+    if(cache.head[c]==nullptr) pool_register_flusher();
+    pool_node* node = static_cast<pool_node*>(p);
+    node->next = cache.head[c];
+    cache.head[c] = node;
+    size_t batch = pool_batch_count(c);
+    if(++cache.count[c]<2 * batch) return;
+    //two batches cached -> hand one to the depot so threads that only free dont hoard memory
+    pool_node* last = node;
+    for(size_t i = 1; i<batch; i++) last = last->next;
+    cache.head[c] = last->next;
+    cache.count[c] -= batch;
+    last->next = nullptr;
+    pool_depot::instance().give_batch(c, node);
+}
+
+}
+
+//allocator for small blocks (tiny vectors, nodes), blocks up to 1 KiB come from power of two size classes
+//every thread keeps its own free lists and only takes the depot lock once per batch of about 4 KiB,
+//so allocating and freeing is a few instructions and scales with the thread count
+//allocate_at_least reports the whole size class -> a vector of ints starts at 4 elements and
+//growing to 16 takes two allocations instead of five
+//blocks can be freed on any thread, they go into the cache of the thread that frees them
+//bigger blocks come from operator new, memory of the pool is kept for reuse and never given back
+template<typename T>
+class pool_allocator
+{
+    static_assert(alignof(T)<=alignof(std::max_align_t), "pool_allocator only guarantees the alignment of max_align_t");
+
+    public:
+    using value_type = T;
+
+    pool_allocator() noexcept = default;
+    template<typename U>
+    pool_allocator(const pool_allocator<U>&) noexcept{}
+
+    T* allocate(size_t n)
+    {
+        return allocate_at_least(n).ptr;
+    }
+
+    //storage for at least n elements, count includes what else fits in the size class
+    allocation_result<T*> allocate_at_least(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        size_t bytes = n * sizeof(T);
+        if(bytes>detail::pool_max_block) return {static_cast<T*>(::operator new(bytes)), n};
+        size_t c = detail::pool_class_of(bytes);
+        return {static_cast<T*>(detail::pool_allocate(c)), detail::pool_block_size(c) / sizeof(T)};
+    }
+
+    //n is the count from allocate or allocate_at_least, both map to the same size class
+    void deallocate(T* p, size_t n) noexcept
+    {
+        size_t bytes = n * sizeof(T);
+        if(bytes>detail::pool_max_block)
+        {
+            ::operator delete(static_cast<void*>(p));
+        }
+        else
+        {
+            detail::pool_deallocate(p, detail::pool_class_of(bytes));
+        }
+    }
+
+    size_t max_size() const noexcept
+    {
+        return static_cast<size_t>(-1) / sizeof(T);
+    }
+};
+
+template<typename T, typename U>
+bool operator == (const pool_allocator<T>&, const pool_allocator<U>&) noexcept
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator != (const pool_allocator<T>&, const pool_allocator<U>&) noexcept
+{
+    return false;
+}
+
+}
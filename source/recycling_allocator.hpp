@@ -0,0 +1,212 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include "memory.hpp"
+
+namespace mystl
+{
+
+//what the recycling cache of the calling thread did so far
+struct recycling_stats
+{
+    //allocations served from a cached block
+    size_t hits;
+    //allocations that went to operator new
+    size_t misses;
+    //bytes of freed blocks kept for reuse right now
+    size_t bytes_cached;
+
+    double hit_rate() const noexcept
+    {
+        size_t total = hits + misses;
+        return (total==0)?0.0:static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+namespace detail
+{
+
+//bin b holds freed blocks of recycling_min_block << b bytes
+inline constexpr size_t recycling_min_block = 16;
+inline constexpr size_t recycling_bin_count = sizeof(size_t) * 8 - 4;
+inline constexpr size_t recycling_default_limit = size_t(64) << 20;
+
+constexpr size_t recycling_bin_of(size_t bytes) noexcept
+{
+    size_t b = 0;
+    size_t block = recycling_min_block;
+    while(block<bytes)
+    {
+        block <<= 1;
+        b++;
+    }
+    return b;
+}
+
+constexpr size_t recycling_block_size(size_t b) noexcept
+{
+    return recycling_min_block << b;
+}
+
+struct recycling_node
+{
+    recycling_node* next;
+};
+
+//freed blocks of one thread, a free list per power of two bin
+//trivial so it needs no guard on access and stays usable while other thread_locals are destroyed
+struct recycling_cache
+{
+    recycling_node* head[recycling_bin_count];
+    size_t hits;
+    size_t misses;
+    size_t bytes_cached;
+    //0 means recycling_default_limit, so a zero initialized cache is ready to use
+    size_t limit;
+    //set once the thread is exiting, freed blocks go straight back to operator delete then
+    bool closed;
+};
+
+inline thread_local recycling_cache recycling_thread_cache{};
+
+//frees cached blocks, biggest first, until at most keep bytes are left
+inline void recycling_trim(recycling_cache& cache, size_t keep) noexcept
+{
+    for(size_t b = recycling_bin_count; b-->0 && cache.bytes_cached>keep;)
+    {
+        while(cache.head[b]!=nullptr && cache.bytes_cached>keep)
+        {
+            recycling_node* node = cache.head[b];
+            cache.head[b] = node->next;
+            cache.bytes_cached -= recycling_block_size(b);
+            ::operator delete(static_cast<void*>(node));
+        }
+    }
+}
+
+//frees the cache of the thread when it exits
+struct recycling_cache_closer
+{
+    ~recycling_cache_closer()
+    {
+        recycling_cache& cache = recycling_thread_cache;
+        recycling_trim(cache, 0);
+        cache.closed = true;
+    }
+};
+
+inline void* recycling_allocate(size_t b)
+{
+    recycling_cache& cache = recycling_thread_cache;
+    if(recycling_node* node = cache.head[b])
+    {
+        cache.head[b] = node->next;
+        cache.bytes_cached -= recycling_block_size(b);
+        cache.hits++;
+        return node;
+    }
+    cache.misses++;
+    return ::operator new(recycling_block_size(b));
+}
+
+inline void recycling_deallocate(void* p, size_t b) noexcept
+{
+    recycling_cache& cache = recycling_thread_cache;
+    size_t block = recycling_block_size(b);
+    size_t limit = (cache.limit==0)?recycling_default_limit:cache.limit;
+    if(cache.closed || cache.bytes_cached>limit || block>limit - cache.bytes_cached)
+    {
+        ::operator delete(p);
+        return;
+    }
+    //registers the closer of this thread, blocks only enter the cache here
+    static thread_local recycling_cache_closer closer;
+    (void)closer;
+    recycling_node* node = static_cast<recycling_node*>(p);
+    node->next = cache.head[b];
+    cache.head[b] = node;
+    cache.bytes_cached += block;
+}
+
+}
+
+//allocator that keeps freed blocks in per thread power of two bins instead of handing them back to the heap
+//for workers that keep building vectors which grow to similar sizes: the next vector gets a warm block
+//whose pages are already faulted in, even for sizes malloc would map and unmap every time
+//allocate_at_least rounds every block up to a power of two and reports the whole block, so with doubling
+//growth the capacities of all vectors land on the same bins
+//the cache of a thread holds at most a byte cap (64 MiB unless set_cache_limit says otherwise),
+//blocks beyond it are freed, trim() gives the cached memory back and the cache is freed when the thread exits
+//blocks may be freed on any thread, they go into the cache of the thread that frees them
+//all of the static functions work on the cache of the calling thread
+template<typename T>
+class recycling_allocator
+{
+    static_assert(alignof(T)<=__STDCPP_DEFAULT_NEW_ALIGNMENT__, "recycling_allocator only guarantees the alignment of operator new");
+
+    public:
+    using value_type = T;
+
+    recycling_allocator() noexcept = default;
+    template<typename U>
+    recycling_allocator(const recycling_allocator<U>&) noexcept{}
+
+    T* allocate(size_t n)
+    {
+        return allocate_at_least(n).ptr;
+    }
+
+    //storage for at least n elements, count covers the whole power of two block
+    allocation_result<T*> allocate_at_least(size_t n)
+    {
+        if(n>max_size()) throw std::bad_alloc();
+        size_t b = detail::recycling_bin_of(n * sizeof(T));
+        return {static_cast<T*>(detail::recycling_allocate(b)), detail::recycling_block_size(b) / sizeof(T)};
+    }
+
+    //n is the count from allocate or allocate_at_least, both map to the same bin
+    void deallocate(T* p, size_t n) noexcept
+    {
+        detail::recycling_deallocate(p, detail::recycling_bin_of(n * sizeof(T)));
+    }
+
+    size_t max_size() const noexcept
+    {
+        //the biggest power of two a size_t can hold
+        return (static_cast<size_t>(1) << (sizeof(size_t) * 8 - 1)) / sizeof(T);
+    }
+
+    static recycling_stats stats() noexcept
+    {
+        const detail::recycling_cache& cache = detail::recycling_thread_cache;
+        return {cache.hits, cache.misses, cache.bytes_cached};
+    }
+
+    //frees cached blocks, biggest first, until at most keep_bytes are left
+    static void trim(size_t keep_bytes = 0) noexcept
+    {
+        detail::recycling_trim(detail::recycling_thread_cache, keep_bytes);
+    }
+
+    //most bytes the cache keeps, lowering it trims right away
+    static void set_cache_limit(size_t bytes) noexcept
+    {
+        detail::recycling_cache& cache = detail::recycling_thread_cache;
+        cache.limit = (bytes==0)?1:bytes;
+        detail::recycling_trim(cache, bytes);
+    }
+};
+
+template<typename T, typename U>
+bool operator == (const recycling_allocator<T>&, const recycling_allocator<U>&) noexcept
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool operator != (const recycling_allocator<T>&, const recycling_allocator<U>&) noexcept
+{
+    return false;
+}
+
+}
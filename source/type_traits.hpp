@@ -0,0 +1,77 @@
+#pragma once
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace mystl
+{
+
+//a type is trivially relocatable if moving it to new storage and destroying the original
+//does the same thing as copying its bytes and forgetting the original
+//containers use this to move elements around with memcpy/memmove instead of constructor/destructor calls
+//every trivially copyable type qualifies, other types can opt in by specializing this trait
+template<typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template<typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+//smart pointers only point to the heap and never to themselves
+template<typename T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+
+template<typename T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+
+//stateless, but its copy constructor is user provided so it isnt trivially copyable
+template<typename T>
+struct is_trivially_relocatable<std::allocator<T>> : std::true_type {};
+
+//a type has bitwise equality if two objects compare equal exactly when their bytes are equal
+//containers use this to compare elements with memcmp
+//true for integers, enums and pointers, not for floating point (0.0 == -0.0, NaN != NaN) or types with padding
+//other types can opt in by specializing this trait
+template<typename T>
+struct has_bitwise_equality : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>> {};
+
+template<typename T>
+inline constexpr bool has_bitwise_equality_v = has_bitwise_equality<T>::value;
+
+//a type is zero initializable if its value initialized state is all bits zero
+//containers use this to take memory that is already zero (calloc, fresh mmap pages) instead of writing the zeros
+//true for integers, enums, pointers and IEEE floating point, other types can opt in by specializing this trait
+template<typename T>
+struct is_zero_initializable : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> ||
+                                                  (std::is_floating_point_v<T> && std::numeric_limits<T>::is_iec559)> {};
+
+template<typename T>
+inline constexpr bool is_zero_initializable_v = is_zero_initializable<T>::value;
+
+namespace detail
+{
+
+//iterator category of It, only valid for iterators
+template<typename It>
+using iterator_category_t = typename std::iterator_traits<It>::iterator_category;
+
+//true if It is an iterator of at least the given category
+//non-iterators like the integers in my_vector(5, 3) end up as false instead of a hard error
+template<typename It, typename Category, typename = void>
+struct is_iterator_of : std::false_type {};
+
+template<typename It, typename Category>
+struct is_iterator_of<It, Category, std::void_t<iterator_category_t<It>>> : std::is_convertible<iterator_category_t<It>, Category> {};
+
+template<typename It>
+inline constexpr bool is_input_iterator_v = is_iterator_of<It, std::input_iterator_tag>::value;
+
+template<typename It>
+inline constexpr bool is_forward_iterator_v = is_iterator_of<It, std::forward_iterator_tag>::value;
+
+}
+
+}
@@ -1,49 +1,142 @@
 #pragma once
+#include <algorithm>
 #include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
+#include <vector>
+#include "aligned_allocator.hpp"
+#include "checked_iterator.hpp"
+#include "growth_policy.hpp"
+#include "memory.hpp"
+#include "type_traits.hpp"
+
+//bounds checking of operator[]
+//on in debug builds, off when NDEBUG is defined, define MYSTL_BOUNDS_CHECK to 0 or 1 to force either
+//at() always checks
+#ifndef MYSTL_BOUNDS_CHECK
+    #ifdef NDEBUG
+        #define MYSTL_BOUNDS_CHECK 0
+    #else
+        #define MYSTL_BOUNDS_CHECK 1
+    #endif
+#endif
 
 namespace mystl
 {
 
-template<typename T>
+//tag to request default initialization instead of value initialization
+//for trivial types like int or float this leaves the new elements uninitialized -> no writes to the memory at all
+struct default_init_t
+{
+    explicit default_init_t() = default;
+};
+inline constexpr default_init_t default_init{};
+
+//tag for the constructor that takes over an existing block instead of copying it
+struct adopt_buffer_t
+{
+    explicit adopt_buffer_t() = default;
+};
+inline constexpr adopt_buffer_t adopt_buffer{};
 
-class my_vector
+//storage handed out by my_vector::release
+//the new owner has to destroy the first size elements and give the block back with
+//std::allocator_traits<Alloc>::deallocate(allocator, ptr, capacity), or hand it to another my_vector
+template<typename T, typename Alloc>
+struct released_buffer
 {
+    T* ptr;
+    size_t size;
+    size_t capacity;
+    Alloc allocator;
+};
+
+//Alloc provides the storage and constructs the elements, everything goes through std::allocator_traits
+//Growth decides how far the capacity grows when the storage is full, see growth_policy.hpp
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = growth::doubling>
+
+class my_vector : private detail::allocator_holder<Alloc>
+{
+    using holder = detail::allocator_holder<Alloc>;
+    using alloc_traits = std::allocator_traits<Alloc>;
+    static_assert(std::is_same_v<typename alloc_traits::value_type, T>, "allocator value_type has to be T");
+    static_assert(std::is_same_v<typename alloc_traits::pointer, T*>, "fancy pointers are not supported");
+
     public:
 
+    using value_type = T;
+    using allocator_type = Alloc;
+
+    //iterators, raw pointers unless MYSTL_CHECKED_ITERATORS is on
+#if MYSTL_CHECKED_ITERATORS
+    using iterator = detail::checked_iterator<T, my_vector>;
+    using const_iterator = detail::checked_iterator<const T, my_vector>;
+#else
+    using iterator = T*;
+    using const_iterator = const T*;
+#endif
+
     //default constructor
-    my_vector(): _data(nullptr), _size(0), _cap(0){}
+    my_vector() noexcept(std::is_nothrow_default_constructible_v<Alloc>): holder(), _data(nullptr), _size(0), _cap(0){}
+
+    //empty vector that allocates from a
+    explicit my_vector(const Alloc& a) noexcept: holder(a), _data(nullptr), _size(0), _cap(0){}
     
     //construct with n elements
-    explicit my_vector(size_t n): _data(nullptr), _size(0), _cap(0) 
+    explicit my_vector(size_t n, const Alloc& a = Alloc()): my_vector(a) 
     { 
-        reserve(n); 
-        for(size_t i = 0; i<n;i++)
-        {
-            push_back(T());
-        }
+        //constructs directly into one allocation -> no capacity checks and no temporaries
+        resize(n);
+    }
+
+    //construct with n default initialized elements (uninitialized for trivial types)
+    my_vector(size_t n, default_init_t, const Alloc& a = Alloc()): my_vector(a)
+    {
+        resize_default_init(n);
+    }
+
+    //construct with n copies of value
+    my_vector(size_t n, const T& value, const Alloc& a = Alloc()): my_vector(a)
+    {
+        //delegating to the default constructor -> the destructor cleans up if assign throws
+        assign(n, value);
+    }
+
+    //construct from the range [first, last)
+    template<typename InputIt, typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    my_vector(InputIt first, InputIt last, const Alloc& a = Alloc()): my_vector(a)
+    {
+        assign(first, last);
     }
 
+    //construct from an initializer list
+    my_vector(std::initializer_list<T> init, const Alloc& a = Alloc()): my_vector(init.begin(), init.end(), a){}
+
     //deconstructor
     ~my_vector() 
     { 
         clear(); 
         //raw memory gets freed
-        operator delete[](static_cast<void*>(_data)); 
+        deallocate(_data, _cap); 
     }
 
-    //copy constructor
-    my_vector(const my_vector& other): _data(nullptr), _size(0), _cap(0)
+    //copy constructor, the allocator decides what the copy gets through select_on_container_copy_construction
+    my_vector(const my_vector& other): my_vector(other, alloc_traits::select_on_container_copy_construction(other.alloc())){}
+
+    //copy constructor that allocates from a
+    my_vector(const my_vector& other, const Alloc& a): my_vector(a)
     {
         //allocate enough memory for all elements in the other vector to fit
         reserve(other._size);
-        //copy construct each element
-        for(size_t i = 0; i<other._size;i++)
-        {
-            push_back(other._data[i]);
-        }
+        //copy construct all elements in one go
+        _size = static_cast<size_t>(copy_construct(other._data, other._data + other._size, _data) - _data);
     }
 
     //copy assignment
@@ -51,45 +144,285 @@ class my_vector
     {
         //check for self assignment
         if(this==&other) return *this;
-        clear();
-        reserve(other._size);
-        for(size_t i = 0; i<other._size; i++)
+        if constexpr(alloc_traits::propagate_on_container_copy_assignment::value)
         {
-            push_back(other._data[i]);
+            if(!(alloc()==other.alloc()))
+            {
+                //our storage belongs to the old allocator -> give it back before taking over the new one
+                clear();
+                deallocate(_data, _cap);
+                _data = nullptr;
+                invalidate_iterators();
+                _cap = 0;
+            }
+            alloc() = other.alloc();
         }
+        assign(other._data, other._data + other._size);
+        return *this;
+    }
+
+    //initializer list assignment
+    my_vector& operator = (std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
         return *this;
     }
 
-    //move constructor
-    my_vector(my_vector&& other) noexcept: _data(other._data), _size(other._size), _cap(other._cap)
+    //move constructor, the allocator moves along with the storage
+    my_vector(my_vector&& other) noexcept: holder(std::move(other.alloc())), _data(other._data), _size(other._size), _cap(other._cap)
     {
         //make other vector empty
         other._data = nullptr;
+        other.invalidate_iterators();
         other._size = 0;
         other._cap = 0;
     }
 
+    //move constructor that allocates from a
+    my_vector(my_vector&& other, const Alloc& a): my_vector(a)
+    {
+        if(alloc()==other.alloc())
+        {
+            take_storage(other);
+        }
+        else
+        {
+            //a cant free the storage of other -> move the elements over one by one
+            assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+    }
+
     //move assignment
-    my_vector& operator = (my_vector&& other)
+    //only noexcept if the storage can always change hands, otherwise unequal allocators move element by element
+    my_vector& operator = (my_vector&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                         alloc_traits::is_always_equal::value)
     {
-        if(this != &other)
+        if(this==&other) return *this;
+        if constexpr(alloc_traits::propagate_on_container_move_assignment::value)
         {
-            //clear current elements
+            //free our storage with the old allocator, then take over both
+            take_storage(other);
+            alloc() = std::move(other.alloc());
+        }
+        else if constexpr(alloc_traits::is_always_equal::value)
+        {
+            take_storage(other);
+        }
+        else
+        {
+            if(alloc()==other.alloc())
+            {
+                take_storage(other);
+            }
+            else
+            {
+                assign(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+            }
+        }
+        return *this;
+    }
+
+    //takes over the block ptr of capacity elements, the first size of them have to be constructed already
+    //the block has to come from an allocator equal to a, so a can free it later -> no copy at all
+    //with malloc_allocator that includes buffers from C code that uses malloc
+    my_vector(adopt_buffer_t, T* ptr, size_t size, size_t capacity, const Alloc& a = Alloc()) noexcept:
+        holder(a), _data(ptr), _size(size), _cap(capacity){}
+
+    //takes over a block from release()
+    explicit my_vector(released_buffer<T, Alloc>&& buffer) noexcept:
+        holder(buffer.allocator), _data(buffer.ptr), _size(buffer.size), _cap(buffer.capacity)
+    {
+        buffer.ptr = nullptr;
+        buffer.size = 0;
+        buffer.capacity = 0;
+    }
+
+    //hands the storage with its elements to the caller and leaves the vector empty, nothing is copied or destroyed
+    released_buffer<T, Alloc> release() noexcept
+    {
+        released_buffer<T, Alloc> buffer{_data, _size, _cap, alloc()};
+        _data = nullptr;
+        invalidate_iterators();
+        _size = 0;
+        _cap = 0;
+        return buffer;
+    }
+
+    //std::vector doesnt give its buffer away and cant take one either -> converting is one bulk move
+    //of the elements (a memcpy for trivially copyable types), the storage itself gets allocated anew
+    explicit my_vector(std::vector<T, Alloc>&& other): my_vector(other.get_allocator())
+    {
+        reserve(other.size());
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            _size = static_cast<size_t>(copy_construct(other.data(), other.data() + other.size(), _data) - _data);
+        }
+        else
+        {
+            _size = static_cast<size_t>(copy_construct(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()), _data) - _data);
+        }
+        other.clear();
+    }
+
+    explicit my_vector(const std::vector<T, Alloc>& other): my_vector(other.get_allocator())
+    {
+        reserve(other.size());
+        _size = static_cast<size_t>(copy_construct(other.data(), other.data() + other.size(), _data) - _data);
+    }
+
+    //moves the elements into a std::vector with the same allocator, this vector is left empty
+    std::vector<T, Alloc> to_std_vector() &&
+    {
+        std::vector<T, Alloc> result(alloc());
+        result.reserve(_size);
+        if constexpr(std::is_trivially_copyable_v<T>)
+        {
+            result.insert(result.end(), _data, _data + _size);
+        }
+        else
+        {
+            result.insert(result.end(), std::make_move_iterator(_data), std::make_move_iterator(_data + _size));
+        }
+        clear();
+        return result;
+    }
+
+    //copies the elements into a std::vector with the same allocator
+    std::vector<T, Alloc> to_std_vector() const &
+    {
+        return std::vector<T, Alloc>(_data, _data + _size, alloc());
+    }
+
+    //copy of the allocator
+    allocator_type get_allocator() const noexcept
+    {
+        return alloc();
+    }
+
+    //replace the content with the range [first, last)
+    template<typename InputIt, typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    void assign(InputIt first, InputIt last)
+    {
+        if constexpr(detail::is_forward_iterator_v<InputIt>)
+        {
+            //size is known up front -> at most one allocation
+            size_t n = static_cast<size_t>(std::distance(first, last));
+            if(n>_cap)
+            {
+                //the old elements cant be reused -> copy into a block of exactly n, then drop the old one
+                size_t new_cap = n;
+                T* new_data = allocate(new_cap);
+                try
+                {
+                    copy_construct(first, last, new_data);
+                }
+                catch(...)
+                {
+                    deallocate(new_data, new_cap);
+                    throw;
+                }
+                clear();
+                deallocate(_data, _cap);
+                _data = new_data;
+                invalidate_iterators();
+                _size = n;
+                _cap = new_cap;
+                return;
+            }
+            //enough capacity -> assign over the live elements so they can keep their own resources
+            //(a string keeps its heap buffer), construct the missing ones and destroy the extra ones
+            size_t common = (n<_size)?n:_size;
+            InputIt mid = copy_assign(first, common, _data);
+            if(n>_size)
+            {
+                copy_construct(mid, last, _data + _size);
+            }
+            else
+            {
+                destroy(_data + n, _data + _size);
+            }
+            _size = n;
+        }
+        else
+        {
+            //single pass iterators can only be counted by consuming them -> reuse what is there, then grow as we go
+            size_t i = 0;
+            for(; i<_size && first!=last; ++i, ++first)
+            {
+                _data[i] = *first;
+            }
+            destroy(_data + i, _data + _size);
+            _size = i;
+            for(; first!=last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+    }
+
+    //replace the content with n copies of value
+    void assign(size_t n, const T& value)
+    {
+        if(n>_cap)
+        {
+            //fill the new block first, value might be one of our own elements
+            size_t new_cap = n;
+            T* new_data = allocate(new_cap);
+            try
+            {
+                fill_construct(new_data, n, value);
+            }
+            catch(...)
+            {
+                deallocate(new_data, new_cap);
+                throw;
+            }
             clear();
-            //free current memory
-            operator delete[](static_cast<void*>(_data));
+            deallocate(_data, _cap);
+            _data = new_data;
+            invalidate_iterators();
+            _size = n;
+            _cap = new_cap;
+            return;
+        }
+        //enough capacity -> overwrite what is there, then construct or destroy the difference
+        size_t common = (n<_size)?n:_size;
+        for(size_t i = 0; i<common; i++)
+        {
+            _data[i] = value;
+        }
+        if(n>_size)
+        {
+            fill_construct(_data + _size, n - _size, value);
+        }
+        else
+        {
+            destroy(_data + n, _data + _size);
+        }
+        _size = n;
+    }
 
-            //take ownership of other vectors buffers
-            _data = other._data;
-            _size = other._size;
-            _cap = other._cap;
+    //replace the content with an initializer list
+    void assign(std::initializer_list<T> init)
+    {
+        assign(init.begin(), init.end());
+    }
 
-            //empty other vector
-            other._data = nullptr;
-            other._size = 0;
-            other._cap = 0;
+    //swap contents with other, only the pointers and counters change hands
+    //the allocators are swapped too if they propagate on swap, otherwise they have to compare equal
+    void swap(my_vector& other) noexcept
+    {
+        if constexpr(alloc_traits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(alloc(), other.alloc());
         }
-        return *this;
+        //iterators stay with the storage, checked ones remember the vector though -> treat them as invalid
+        invalidate_iterators();
+        other.invalidate_iterators();
+        std::swap(_data, other._data);
+        std::swap(_size, other._size);
+        std::swap(_cap, other._cap);
     }
 
     //size query
@@ -101,132 +434,460 @@ class my_vector
     //empty query
     bool empty() const noexcept{return _size==0;}
 
+    //change the size to n, new elements are value initialized
+    void resize(size_t n)
+    {
+        if constexpr(can_allocate_zeroed)
+        {
+            if(_size==0 && n>_cap)
+            {
+                //nothing to keep and value initialized means all zero -> take a block that is zero already,
+                //big ones come straight from the kernel and dont touch a page until it is used
+                size_t new_cap = grow_capacity(n);
+                allocation_result<T*> result = alloc().allocate_zeroed(new_cap);
+                deallocate(_data, _cap);
+                _data = result.ptr;
+                invalidate_iterators();
+                _cap = result.count;
+                _size = n;
+                return;
+            }
+        }
+        resize_with(n, [this](T* dest, size_t count){ value_construct(dest, count); });
+    }
+
+    //change the size to n, new elements are copies of value
+    void resize(size_t n, const T& value)
+    {
+        if(n>_cap)
+        {
+            //value might be one of our own elements -> keep a copy, growing would move it
+            T copy(value);
+            resize_with(n, [this, &copy](T* dest, size_t count){ fill_construct(dest, count, copy); });
+            return;
+        }
+        resize_with(n, [this, &value](T* dest, size_t count){ fill_construct(dest, count, value); });
+    }
+
+    //change the size to n, new elements are default initialized
+    //for trivially default constructible types (int, float, pods) the new elements are left uninitialized,
+    //so big scratch buffers dont get touched before they are written for real
+    void resize_default_init(size_t n)
+    {
+        resize_with(n, [this](T* dest, size_t count){ default_construct(dest, count); });
+    }
+
     //reserve specific capacity
     void reserve(size_t new_cap)
     {
         //capacity shouldnt be lowered -> early out
         if(new_cap<=_cap) return;
+        if constexpr(can_reallocate)
+        {
+            //the allocator can often grow the block in place, and moves the bytes itself when it cant
+            reallocate(new_cap);
+            return;
+        }
         //allocate raw memory
-        T* new_data = static_cast<T*>(operator new[](new_cap * sizeof(T)));
-        //move construct existing data into new storage
-        for(size_t i = 0; i<_size;i++)
+        T* new_data = allocate(new_cap);
+        //move existing data into new storage, if that throws the vector stays as it was
+        try
         {
-            new(new_data + i) T(std::move(_data[i]));
+            relocate_to(new_data, _size, 0);
         }
-        //destroy old elements
-        for(size_t i = 0; i<_size;i++)
+        catch(...)
         {
-            _data[i].~T();
+            deallocate(new_data, new_cap);
+            throw;
         }
         //free old memory
-        operator delete[](static_cast<void*>(_data));
+        deallocate(_data, _cap);
         //update pointer to new storage
         _data = new_data;
+        invalidate_iterators();
         //update capacity
         _cap = new_cap;
     }
 
-    //element access operator
-    T& operator[](size_t id)
+    //give unused capacity back to the allocator
+    void shrink_to_fit()
     {
-        if(id>=_size)
+        if(_cap==_size) return;
+        if(_size==0)
+        {
+            deallocate(_data, _cap);
+            _data = nullptr;
+            invalidate_iterators();
+            _cap = 0;
+            return;
+        }
+        if constexpr(can_reallocate)
+        {
+            //shrinking usually just trims the block in place
+            reallocate(_size);
+        }
+        else
         {
-            throw std::out_of_range("tried to access out of bounds id");
-        } 
+            size_t new_cap = _size;
+            T* new_data = allocate(new_cap);
+            try
+            {
+                relocate_to(new_data, _size, 0);
+            }
+            catch(...)
+            {
+                deallocate(new_data, new_cap);
+                throw;
+            }
+            deallocate(_data, _cap);
+            _data = new_data;
+            invalidate_iterators();
+            _cap = new_cap;
+        }
+    }
 
+    //bytes of the storage block that dont hold an element
+    size_t slack_bytes() const noexcept
+    {
+        return (_cap - _size) * sizeof(T);
+    }
+
+    //element access operator, only checked if MYSTL_BOUNDS_CHECK is on
+    //unchecked access keeps loops free of branches and exception paths so they can be vectorized
+    T& operator[](size_t id)
+    {
+#if MYSTL_BOUNDS_CHECK
+        check_index(id);
+#endif
         return _data[id];
     }
     const T& operator[](size_t id) const
     {
-        if(id>=_size)
-        { 
-            throw std::out_of_range("tried to access out of bounds id");
-        }
+#if MYSTL_BOUNDS_CHECK
+        check_index(id);
+#endif
+        return _data[id];
+    }
+
+    //element access, always checked
+    T& at(size_t id)
+    {
+        check_index(id);
+        return _data[id];
+    }
+    const T& at(size_t id) const
+    {
+        check_index(id);
         return _data[id];
     }
 
     //push_back copy
     void push_back(const T& val)
     {
-        if(_size==_cap)
-        {   
-            //doubling _cap trades unused memory for way fewer reallocations
-            reserve((_cap==0)?1:_cap*2);
-            /*
-            * old:
-            * reserve(_cap++);
-            */
-        }
         //copy construct val
-        new(_data + _size) T(val); 
-        _size++;
+        emplace_back(val);
     }
 
     //push_back move
     void push_back(T&& val)
+    {
+        //move construct val
+        emplace_back(std::move(val));
+    }
+
+    //construct a new element at the end from args, no temporary is created
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
     {
         if(_size==_cap)
         {
-            reserve((_cap==0)?1:_cap*2);
+            //args might point into the old storage -> build the element in the new block before relocating
+            return emplace_realloc(_size, std::forward<Args>(args)...);
         }
-        //move construct val
-        new(_data + _size) T(std::move(val));   
+        alloc_traits::construct(alloc(), _data + _size, std::forward<Args>(args)...);
         _size++;
+        return _data[_size-1];
     }
 
-    //pop_back (remove last element)
-    void pop_back()
+    //push_back without the capacity check, there has to be room for one more element (reserve first)
+    //only checked if MYSTL_BOUNDS_CHECK is on, like operator[]
+    void push_back_unchecked(const T& val)
     {
-        if(_size==0)
+        emplace_back_unchecked(val);
+    }
+
+    void push_back_unchecked(T&& val)
+    {
+        emplace_back_unchecked(std::move(val));
+    }
+
+    //emplace_back without the capacity check, there has to be room for one more element
+    template<typename... Args>
+    T& emplace_back_unchecked(Args&&... args)
+    {
+#if MYSTL_BOUNDS_CHECK
+        if(_size==_cap)
         {
-            throw std::out_of_range("tried to use pop_back on empty vector");
+            throw_out_of_range("unchecked append without free capacity");
         }
-        //reduce logical size first
-        --_size;
-        //destroy element at former end
-        _data[_size].~T();
+#endif
+        alloc_traits::construct(alloc(), _data + _size, std::forward<Args>(args)...);
+        _size++;
+        return _data[_size-1];
     }
 
-    //clear function, destroys all elements but keeps capacity
-    void clear()
+    //append the range [first, last) at the end
+    //for forward iterators the capacity is checked once and the size is set once
+    template<typename InputIt, typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    void append(InputIt first, InputIt last)
     {
-        for(size_t i = 0; i<_size; i++)
+        if constexpr(detail::is_forward_iterator_v<InputIt>)
         {
-            _data[i].~T();
+            size_t n = static_cast<size_t>(std::distance(first, last));
+            if(n>_cap - _size)
+            {
+                //the range might be our own elements -> insert copies into the new block before the old one goes away
+                insert(cend(), first, last);
+                return;
+            }
+            copy_construct(first, last, _data + _size);
+            _size += n;
+        }
+        else
+        {
+            for(; first!=last; ++first)
+            {
+                emplace_back(*first);
+            }
         }
-        _size = 0;
     }
 
-    //equal operator
-    bool operator == (const my_vector& other)
+    //append n elements constructed from the results of gen(), called n times in order
+    //the capacity is checked once and the size is set once, if gen or a constructor throws nothing is appended
+    template<typename Generator>
+    void append_n(size_t n, Generator gen)
     {
-        //check size diff
-        if(_size!=other._size) return false;
-        //check data diff
-        for(size_t i = 0; i<_size; i++)
+        if(n>_cap - _size)
+        {
+            reserve(grow_capacity(_size + n));
+        }
+        T* dest = _data + _size;
+        size_t i = 0;
+        try
+        {
+            for(; i<n; i++)
+            {
+                alloc_traits::construct(alloc(), dest + i, gen());
+            }
+        }
+        catch(...)
         {
-            if(_data[i]!=other._data[i]) return false;
+            destroy(dest, dest + i);
+            throw;
         }
-        return true;
+        _size += n;
     }
 
-    //inequal operator
-    bool operator != (const my_vector& other)
+    //grows the size by n and returns a pointer to the new elements, which are left uninitialized
+    //meant to be written directly (parsers, read calls), only for trivial types
+    //if fewer elements get written, resize down afterwards
+    T* uninitialized_append(size_t n)
     {
-        return !(*this == other);
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                      "uninitialized elements are only allowed for trivial types");
+        if(n>_cap - _size)
+        {
+            reserve(grow_capacity(_size + n));
+        }
+        T* dest = _data + _size;
+        _size += n;
+        return dest;
     }
 
-    //iterators
-    using iterator = T*;
-    using const_iterator = const T*;
+    //construct a new element in front of pos, returns an iterator to it
+    template<typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        size_t id = index_of(pos);
+        if(_size==_cap)
+        {
+            //new block anyway -> construct the element at its final spot and relocate the rest around it
+            emplace_realloc(id, std::forward<Args>(args)...);
+            return begin() + id;
+        }
+        if(id==_size)
+        {
+            alloc_traits::construct(alloc(), _data + _size, std::forward<Args>(args)...);
+            _size++;
+            return begin() + id;
+        }
+        //args might refer to an element that is about to be shifted -> build the new element first
+        T tmp(std::forward<Args>(args)...);
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            //open a gap with one memmove
+            std::memmove(static_cast<void*>(_data + id + 1), static_cast<const void*>(_data + id), (_size - id) * sizeof(T));
+            try
+            {
+                alloc_traits::construct(alloc(), _data + id, std::move(tmp));
+            }
+            catch(...)
+            {
+                //close the gap again so the vector stays untouched
+                std::memmove(static_cast<void*>(_data + id), static_cast<const void*>(_data + id + 1), (_size - id) * sizeof(T));
+                throw;
+            }
+            _size++;
+        }
+        else
+        {
+            //last element moves into the uninitialized slot, the rest shifts by move assignment
+            alloc_traits::construct(alloc(), _data + _size, std::move(_data[_size-1]));
+            //the new tail is live now, a throwing assignment below must still destroy it
+            _size++;
+            std::move_backward(_data + id, _data + _size - 2, _data + _size - 1);
+            _data[id] = std::move(tmp);
+        }
+        return begin() + id;
+    }
+
+    //insert a copy of value in front of pos
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    //insert value in front of pos by moving it
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    //insert n copies of value in front of pos
+    iterator insert(const_iterator pos, size_t n, const T& value)
+    {
+        size_t id = index_of(pos);
+        if(n==0) return begin() + id;
+        //value might be one of our own elements that is about to be shifted
+        T copy(value);
+        insert_with(id, n,
+            [this, &copy](T* dest, size_t, size_t count){ fill_construct(dest, count, copy); },
+            [&copy](T* dest, size_t, size_t count){ std::fill_n(dest, count, copy); });
+        return begin() + id;
+    }
+
+    //insert the range [first, last) in front of pos
+    template<typename InputIt, typename = std::enable_if_t<detail::is_input_iterator_v<InputIt>>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        size_t id = index_of(pos);
+        if constexpr(detail::is_forward_iterator_v<InputIt>)
+        {
+            //size is known up front -> grow at most once and shift the tail once
+            size_t n = static_cast<size_t>(std::distance(first, last));
+            if(n==0) return begin() + id;
+            insert_with(id, n,
+                [this, &first](T* dest, size_t from, size_t count)
+                {
+                    InputIt it = std::next(first, static_cast<std::ptrdiff_t>(from));
+                    copy_construct(it, std::next(it, static_cast<std::ptrdiff_t>(count)), dest);
+                },
+                [&first](T* dest, size_t from, size_t count)
+                {
+                    std::copy_n(std::next(first, static_cast<std::ptrdiff_t>(from)), count, dest);
+                });
+        }
+        else if(id==_size)
+        {
+            for(; first!=last; ++first)
+            {
+                emplace_back(*first);
+            }
+        }
+        else
+        {
+            //single pass range in the middle -> buffer it first so the tail only moves once
+            my_vector buffer(first, last, alloc());
+            insert(begin() + id, std::make_move_iterator(buffer.begin()), std::make_move_iterator(buffer.end()));
+        }
+        return begin() + id;
+    }
+
+    //insert an initializer list in front of pos
+    iterator insert(const_iterator pos, std::initializer_list<T> init)
+    {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    //remove the element at pos, returns an iterator to the element after it
+    iterator erase(const_iterator pos)
+    {
+        if(index_of(pos)==_size)
+        {
+            throw std::out_of_range("tried to erase end");
+        }
+        return erase(pos, pos + 1);
+    }
+
+    //remove the elements in [first, last), returns an iterator to the element after them
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        size_t id = index_of(first);
+        size_t id_last = index_of(last);
+        if(id_last<id)
+        {
+            throw std::out_of_range("tried to erase an inverted range");
+        }
+        size_t n = id_last - id;
+        if(n==0) return begin() + id;
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            //destroy the erased elements, then close the gap with one memmove
+            destroy(_data + id, _data + id_last);
+            std::memmove(static_cast<void*>(_data + id), static_cast<const void*>(_data + id_last), (_size - id_last) * sizeof(T));
+        }
+        else
+        {
+            //shift the tail down by move assignment, the moved-from leftovers at the end get destroyed
+            std::move(_data + id_last, _data + _size, _data + id);
+            destroy(_data + _size - n, _data + _size);
+        }
+        _size -= n;
+        return begin() + id;
+    }
+
+    //pop_back (remove last element)
+    void pop_back()
+    {
+        if(_size==0)
+        {
+            throw std::out_of_range("tried to use pop_back on empty vector");
+        }
+        //reduce logical size first
+        --_size;
+        //destroy element at former end
+        destroy(_data + _size, _data + _size + 1);
+    }
+
+    //clear function, destroys all elements but keeps capacity
+    void clear()
+    {
+        destroy(_data, _data + _size);
+        _size = 0;
+        invalidate_iterators();
+    }
+
+    //pointer to the first element, a raw pointer in every iterator mode
+    T* data() noexcept{return _data;}
+    const T* data() const noexcept{return _data;}
 
     //iterator methods
-    iterator begin() {return _data;}
-    iterator end() {return _data+_size;}
-    const_iterator begin() const {return _data;}
-    const_iterator end() const {return _data+_size;}
-    const_iterator cbegin() const {return _data;}
-    const_iterator cend() const {return _data+_size;}
+    iterator begin() {return make_iterator(_data);}
+    iterator end() {return make_iterator(_data+_size);}
+    const_iterator begin() const {return make_iterator(_data);}
+    const_iterator end() const {return make_iterator(_data+_size);}
+    const_iterator cbegin() const {return make_iterator(_data);}
+    const_iterator cend() const {return make_iterator(_data+_size);}
 
     //reverse iterators -> using std::reverse_iterator, might make my own in the future
     using reverse_iterator = std::reverse_iterator<iterator>;
@@ -241,12 +902,654 @@ class my_vector
     const_reverse_iterator crend() const { return const_reverse_iterator(begin()); }
 
     private:
+    //erase_if compacts relocatable elements with memmove and sets the size directly
+    template<typename U, typename A, typename G, typename Pred>
+    friend size_t erase_if(my_vector<U, A, G>& v, Pred pred);
+
+    using holder::alloc;
+
+    //allocator_traits construct and destroy do nothing but placement new and the destructor call
+    //-> trivial copies can be memcpy and trivial destructors can be skipped
+    static constexpr bool constructs_in_place = detail::constructs_in_place_v<Alloc>;
+
+    //the allocator can resize a block and the elements survive having their bytes moved
+    static constexpr bool can_reallocate = is_trivially_relocatable_v<T> && detail::has_reallocate_v<Alloc>;
+
+    //value initialized elements can come from a block the allocator hands out zeroed
+    static constexpr bool can_allocate_zeroed = is_zero_initializable_v<T> && constructs_in_place && detail::has_allocate_zeroed_v<Alloc>;
+
+    //raw storage for at least n elements, nothing gets constructed
+    //allocators with an allocate_at_least hook may round the block up -> n is raised to the number of elements it really holds
+    T* allocate(size_t& n)
+    {
+        if(n==0) return nullptr;
+        if(n>alloc_traits::max_size(alloc())) throw std::bad_alloc();
+        if constexpr(detail::has_allocate_at_least_v<Alloc>)
+        {
+            allocation_result<T*> result = alloc().allocate_at_least(n);
+            n = result.count;
+            return result.ptr;
+        }
+        else
+        {
+            return alloc_traits::allocate(alloc(), n);
+        }
+    }
+
+    //frees storage of n elements from allocate, the elements have to be destroyed already
+    void deallocate(T* p, size_t n) noexcept
+    {
+        if(p!=nullptr) alloc_traits::deallocate(alloc(), p, n);
+    }
+
+    //resizes the storage block to hold new_cap elements through the allocators reallocate hook
+    //if it fails the old block is untouched
+    void reallocate(size_t new_cap)
+    {
+        static_assert(can_reallocate, "reallocate moves the elements as raw bytes");
+        if(new_cap>alloc_traits::max_size(alloc())) throw std::bad_alloc();
+        allocation_result<T*> result = alloc().reallocate(_data, _cap, new_cap);
+        _data = result.ptr;
+        invalidate_iterators();
+        _cap = result.count;
+    }
+
+    //frees the own storage and takes the one of other, other is left empty
+    void take_storage(my_vector& other) noexcept
+    {
+        clear();
+        deallocate(_data, _cap);
+        _data = other._data;
+        invalidate_iterators();
+        _size = other._size;
+        _cap = other._cap;
+        other._data = nullptr;
+        other.invalidate_iterators();
+        other._size = 0;
+        other._cap = 0;
+    }
+
+    //capacity to grow to when the storage is too small for required elements
+    size_t grow_capacity(size_t required) const
+    {
+        //geometric growth trades unused memory for way fewer reallocations, the policy picks the trade-off
+        return Growth::next_capacity(_cap, required, sizeof(T));
+        /*
+        * old:
+        * reserve(_cap++);
+        */
+    }
+
+    //throws if id is not a valid element index
+    void check_index(size_t id) const
+    {
+        if(id>=_size)
+        {
+            throw_out_of_range("tried to access out of bounds id");
+        }
+    }
+
+    //kept out of line so the inlined access stays a compare and a branch
+    [[noreturn]] static void throw_out_of_range(const char* msg)
+    {
+        throw std::out_of_range(msg);
+    }
+
+    //turns an iterator into an index, throws if it doesnt point into [begin, end]
+    size_t index_of(const_iterator pos) const
+    {
+#if MYSTL_CHECKED_ITERATORS
+        const T* p = pos.base_for(this);
+#else
+        const T* p = pos;
+#endif
+        if(p<_data || p>_data + _size)
+        {
+            throw std::out_of_range("iterator does not point into this vector");
+        }
+        return static_cast<size_t>(p - _data);
+    }
+
+#if MYSTL_CHECKED_ITERATORS
+    template<typename U, typename O>
+    friend class detail::checked_iterator;
+
+    iterator make_iterator(T* p) noexcept{return iterator(p, this);}
+    const_iterator make_iterator(const T* p) const noexcept{return const_iterator(p, this);}
+
+    //every iterator made before becomes invalid
+    void invalidate_iterators() noexcept{++_generation;}
+#else
+    iterator make_iterator(T* p) noexcept{return p;}
+    const_iterator make_iterator(const T* p) const noexcept{return p;}
+
+    //raw pointer iterators dont know about it
+    void invalidate_iterators() noexcept{}
+#endif
+
+    //inserts n new elements at id
+    //construct(dest, from, count) creates source elements [from, from + count) in uninitialized dest,
+    //assign(dest, from, count) assigns them to live (moved-from) elements
+    template<typename Construct, typename Assign>
+    void insert_with(size_t id, size_t n, Construct construct, Assign assign)
+    {
+        if(n>_cap - _size)
+        {
+            //one new block for everything -> new elements go straight to their final spot, the rest relocates around them
+            size_t new_cap = grow_capacity(_size + n);
+            T* new_data = allocate(new_cap);
+            try
+            {
+                construct(new_data + id, 0, n);
+            }
+            catch(...)
+            {
+                deallocate(new_data, new_cap);
+                throw;
+            }
+            try
+            {
+                relocate_to(new_data, id, n);
+            }
+            catch(...)
+            {
+                destroy(new_data + id, new_data + id + n);
+                deallocate(new_data, new_cap);
+                throw;
+            }
+            deallocate(_data, _cap);
+            _data = new_data;
+            invalidate_iterators();
+            _cap = new_cap;
+            _size += n;
+            return;
+        }
+        size_t after = _size - id;
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            //open the gap with one memmove and build the new elements inside it
+            std::memmove(static_cast<void*>(_data + id + n), static_cast<const void*>(_data + id), after * sizeof(T));
+            try
+            {
+                construct(_data + id, 0, n);
+            }
+            catch(...)
+            {
+                std::memmove(static_cast<void*>(_data + id), static_cast<const void*>(_data + id + n), after * sizeof(T));
+                throw;
+            }
+            _size += n;
+        }
+        else
+        {
+            T* old_end = _data + _size;
+            if(after>n)
+            {
+                //last n elements move into uninitialized storage, the rest shifts inside live elements
+                move_construct(old_end - n, old_end, old_end);
+                _size += n;
+                std::move_backward(_data + id, old_end - n, old_end);
+                assign(_data + id, 0, n);
+            }
+            else
+            {
+                //the new elements reach past the old end -> that part gets constructed, the rest assigned
+                construct(old_end, after, n - after);
+                _size += n - after;
+                move_construct(_data + id, old_end, old_end + n - after);
+                _size += after;
+                assign(_data + id, 0, after);
+            }
+        }
+    }
+
+    //grows into a new block and constructs a new element at id while doing so
+    template<typename... Args>
+    T& emplace_realloc(size_t id, Args&&... args)
+    {
+        size_t new_cap = grow_capacity(_size + 1);
+        if constexpr(can_reallocate)
+        {
+            //args might point into the block reallocate is about to move -> build the element on the side first,
+            //its bytes get moved into place afterwards, which the trait says is fine
+            alignas(T) unsigned char slot[sizeof(T)];
+            T* elem = reinterpret_cast<T*>(slot);
+            alloc_traits::construct(alloc(), elem, std::forward<Args>(args)...);
+            try
+            {
+                reallocate(new_cap);
+            }
+            catch(...)
+            {
+                destroy(elem, elem + 1);
+                throw;
+            }
+            std::memmove(static_cast<void*>(_data + id + 1), static_cast<const void*>(_data + id), (_size - id) * sizeof(T));
+            std::memcpy(static_cast<void*>(_data + id), static_cast<const void*>(slot), sizeof(T));
+            _size++;
+            return _data[id];
+        }
+        T* new_data = allocate(new_cap);
+        try
+        {
+            alloc_traits::construct(alloc(), new_data + id, std::forward<Args>(args)...);
+        }
+        catch(...)
+        {
+            deallocate(new_data, new_cap);
+            throw;
+        }
+        //elements before and after the new one
+        try
+        {
+            relocate_to(new_data, id, 1);
+        }
+        catch(...)
+        {
+            destroy(new_data + id, new_data + id + 1);
+            deallocate(new_data, new_cap);
+            throw;
+        }
+        deallocate(_data, _cap);
+        _data = new_data;
+        invalidate_iterators();
+        _cap = new_cap;
+        _size++;
+        return _data[id];
+    }
+
+    //destroys the elements in [first, last), the storage stays
+    void destroy(T* first, T* last) noexcept
+    {
+        if constexpr(!std::is_trivially_destructible_v<T> || !constructs_in_place)
+        {
+            for(; first!=last; ++first)
+            {
+                alloc_traits::destroy(alloc(), first);
+            }
+        }
+    }
+
+    //copy constructs [first, last) into uninitialized dest, returns the end of the new elements
+    template<typename It>
+    T* copy_construct(It first, It last, T* dest)
+    {
+        if constexpr(std::is_pointer_v<It> && std::is_trivially_copyable_v<T> && constructs_in_place &&
+                     std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>)
+        {
+            //contiguous source of the same trivial type -> plain byte copy
+            size_t n = static_cast<size_t>(last - first);
+            if(n>0) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+            return dest + n;
+        }
+        else
+        {
+            T* cur = dest;
+            try
+            {
+                for(; first!=last; ++first, ++cur)
+                {
+                    alloc_traits::construct(alloc(), cur, *first);
+                }
+            }
+            catch(...)
+            {
+                //dont leave half a range behind
+                destroy(dest, cur);
+                throw;
+            }
+            return cur;
+        }
+    }
+
+    //shared part of the resize functions, construct(dest, count) creates the new elements
+    template<typename Construct>
+    void resize_with(size_t n, Construct construct)
+    {
+        if(n<=_size)
+        {
+            destroy(_data + n, _data + _size);
+            _size = n;
+            return;
+        }
+        if(n>_cap)
+        {
+            //repeated small resizes shouldnt reallocate every time -> grow at least geometrically
+            reserve(grow_capacity(n));
+        }
+        construct(_data + _size, n - _size);
+        _size = n;
+    }
+
+    //value initializes n elements in uninitialized dest
+    void value_construct(T* dest, size_t n)
+    {
+        if constexpr(is_zero_initializable_v<T> && constructs_in_place)
+        {
+            //value initialized means all bits zero -> one memset
+            if(n>0) std::memset(static_cast<void*>(dest), 0, n * sizeof(T));
+        }
+        else
+        {
+            size_t i = 0;
+            try
+            {
+                for(; i<n; i++)
+                {
+                    alloc_traits::construct(alloc(), dest + i);
+                }
+            }
+            catch(...)
+            {
+                destroy(dest, dest + i);
+                throw;
+            }
+        }
+    }
+
+    //default initializes n elements in uninitialized dest
+    //allocator_traits can only value initialize -> placement new, like default_init asks for
+    void default_construct(T* dest, size_t n)
+    {
+        if constexpr(std::is_trivially_default_constructible_v<T>)
+        {
+            //default initialization of a trivial type does nothing -> dont even walk the memory
+            (void)dest;
+            (void)n;
+        }
+        else
+        {
+            size_t i = 0;
+            try
+            {
+                for(; i<n; i++)
+                {
+                    new(dest + i) T;
+                }
+            }
+            catch(...)
+            {
+                destroy(dest, dest + i);
+                throw;
+            }
+        }
+    }
+
+    //move constructs [first, last) into uninitialized dest, the sources stay alive
+    void move_construct(T* first, T* last, T* dest)
+    {
+        copy_construct(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+    }
+
+    //copy assigns n elements starting at first to the live elements at dest, returns the iterator after the last one read
+    template<typename It>
+    static It copy_assign(It first, size_t n, T* dest)
+    {
+        if constexpr(std::is_pointer_v<It> && std::is_trivially_copyable_v<T> &&
+                     std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>)
+        {
+            //assigning trivial elements is copying their bytes
+            if(n>0) std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), n * sizeof(T));
+            return first + n;
+        }
+        else
+        {
+            for(size_t i = 0; i<n; ++i, ++first)
+            {
+                dest[i] = *first;
+            }
+            return first;
+        }
+    }
+
+    //copy constructs n copies of value into uninitialized dest
+    void fill_construct(T* dest, size_t n, const T& value)
+    {
+        size_t i = 0;
+        try
+        {
+            for(; i<n; i++)
+            {
+                alloc_traits::construct(alloc(), dest + i, value);
+            }
+        }
+        catch(...)
+        {
+            destroy(dest, dest + i);
+            throw;
+        }
+    }
+
+    //moves all elements into the uninitialized block new_data, leaving gap free slots in front of element gap_at
+    //the old elements are destroyed only once all of them made it, if that fails nothing changed (strong guarantee)
+    void relocate_to(T* new_data, size_t gap_at, size_t gap)
+    {
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            //moving the bytes is all a move + destroy would do -> memcpy instead of two loops, and it cant throw
+            //memcpy with nullptr is undefined even for 0 bytes
+            if(gap_at>0) std::memcpy(static_cast<void*>(new_data), static_cast<const void*>(_data), gap_at * sizeof(T));
+            if(_size>gap_at) std::memcpy(static_cast<void*>(new_data + gap_at + gap), static_cast<const void*>(_data + gap_at), (_size - gap_at) * sizeof(T));
+        }
+        else
+        {
+            //move_if_noexcept -> a throwing move constructor is only used if there is no copy constructor
+            move_if_noexcept_construct(_data, _data + gap_at, new_data);
+            try
+            {
+                move_if_noexcept_construct(_data + gap_at, _data + _size, new_data + gap_at + gap);
+            }
+            catch(...)
+            {
+                destroy(new_data, new_data + gap_at);
+                throw;
+            }
+            //destroy old elements
+            destroy(_data, _data + _size);
+        }
+    }
+
+    //move constructs [first, last) into uninitialized dest if that cant throw, copy constructs otherwise
+    void move_if_noexcept_construct(T* first, T* last, T* dest)
+    {
+        if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>)
+        {
+            copy_construct(std::make_move_iterator(first), std::make_move_iterator(last), dest);
+        }
+        else
+        {
+            //the sources stay untouched, so a throwing copy leaves them as they were
+            copy_construct(static_cast<const T*>(first), static_cast<const T*>(last), dest);
+        }
+    }
+
     //pointer to storage for elements
     T* _data;
     //number of valid elements in storage
     size_t _size;
     //element capacity of the container
     size_t _cap;
+#if MYSTL_CHECKED_ITERATORS
+    //bumped whenever all iterators become invalid, checked iterators compare it with the one they were made at
+    size_t _generation = 0;
+#endif
 };
 
-}
\ No newline at end of file
+//vector whose storage starts at a multiple of Align bytes, see aligned_allocator.hpp
+template<typename T, size_t Align = 64, typename Growth = growth::doubling>
+using aligned_vector = my_vector<T, aligned_allocator<T, Align>, Growth>;
+
+//my_vector only owns a pointer to its heap buffer, so moving its bytes is safe if it is for the allocator
+template<typename T, typename Alloc, typename Growth>
+struct is_trivially_relocatable<my_vector<T, Alloc, Growth>> : std::bool_constant<is_trivially_relocatable_v<Alloc>> {};
+
+namespace detail
+{
+
+//index of the first element where a and b differ, n if they dont
+template<typename T>
+size_t first_mismatch(const T* a, const T* b, size_t n)
+{
+    //short ranges usually differ in the first few elements, a plain loop beats the memcmp call there
+    constexpr size_t short_bytes = 128;
+    if constexpr(has_bitwise_equality_v<T>)
+    {
+        if(n * sizeof(T)<short_bytes)
+        {
+            return static_cast<size_t>(std::mismatch(a, a + n, b).first - a);
+        }
+        //memcmp whole blocks, it is vectorized by the C library, and only look at single elements in the block that differs
+        constexpr size_t block = (256 / sizeof(T)>0)?256 / sizeof(T):1;
+        size_t i = 0;
+        while(i<n)
+        {
+            size_t len = (n - i<block)?n - i:block;
+            if(std::memcmp(a + i, b + i, len * sizeof(T))!=0) break;
+            i += len;
+        }
+        for(; i<n; i++)
+        {
+            if(!(a[i]==b[i])) return i;
+        }
+        return n;
+    }
+    else
+    {
+        return static_cast<size_t>(std::mismatch(a, a + n, b).first - a);
+    }
+}
+
+}
+
+//equal operator
+template<typename T, typename Alloc, typename Growth>
+bool operator == (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    //check size diff
+    if(a.size()!=b.size()) return false;
+    if(a.empty()) return true;
+    //check data diff
+    if constexpr(has_bitwise_equality_v<T>)
+    {
+        return std::memcmp(a.data(), b.data(), a.size() * sizeof(T))==0;
+    }
+    else
+    {
+        return std::equal(a.data(), a.data() + a.size(), b.data());
+    }
+}
+
+//inequal operator
+template<typename T, typename Alloc, typename Growth>
+bool operator != (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    return !(a==b);
+}
+
+//lexicographic less, a shorter vector that is a prefix of the longer one comes first
+template<typename T, typename Alloc, typename Growth>
+bool operator < (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    size_t common = (a.size()<b.size())?a.size():b.size();
+    if constexpr(has_bitwise_equality_v<T> && sizeof(T)==1 && std::is_unsigned_v<T>)
+    {
+        //memcmp orders by unsigned bytes, which is exactly the order of unsigned single byte types
+        int diff = (common>0)?std::memcmp(a.data(), b.data(), common):0;
+        if(diff!=0) return diff<0;
+    }
+    else
+    {
+        size_t i = (common>0)?detail::first_mismatch(a.data(), b.data(), common):0;
+        if(i<common) return a.data()[i]<b.data()[i];
+    }
+    return a.size()<b.size();
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator > (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    return b<a;
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator <= (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    return !(b<a);
+}
+
+template<typename T, typename Alloc, typename Growth>
+bool operator >= (const my_vector<T, Alloc, Growth>& a, const my_vector<T, Alloc, Growth>& b)
+{
+    return !(a<b);
+}
+
+//swap overload so std::swap and unqualified swap calls pick the member swap
+template<typename T, typename Alloc, typename Growth>
+void swap(my_vector<T, Alloc, Growth>& a, my_vector<T, Alloc, Growth>& b) noexcept
+{
+    a.swap(b);
+}
+
+//removes all elements for which pred returns true, returns the number of removed elements
+//every kept element is moved at most once
+template<typename T, typename Alloc, typename Growth, typename Pred>
+size_t erase_if(my_vector<T, Alloc, Growth>& v, Pred pred)
+{
+    T* first = v._data;
+    T* last = v._data + v._size;
+    //nothing moves in front of the first match
+    T* write = std::find_if(first, last, pred);
+    if(write==last) return 0;
+    if constexpr(is_trivially_relocatable_v<T>)
+    {
+        //destroy the matches in place and slide each run of kept elements down with one memmove
+        v.destroy(write, write + 1);
+        T* read = write + 1;
+        try
+        {
+            while(read!=last)
+            {
+                if(pred(*read))
+                {
+                    v.destroy(read, read + 1);
+                    ++read;
+                    continue;
+                }
+                //*read is kept, the run continues up to the next match
+                T* run_end = std::find_if(read + 1, last, pred);
+                size_t run = static_cast<size_t>(run_end - read);
+                std::memmove(static_cast<void*>(write), static_cast<const void*>(read), run * sizeof(T));
+                write += run;
+                read = run_end;
+            }
+        }
+        catch(...)
+        {
+            //pred threw -> keep everything not looked at yet so there are no holes
+            size_t rest = static_cast<size_t>(last - read);
+            std::memmove(static_cast<void*>(write), static_cast<const void*>(read), rest * sizeof(T));
+            v._size = static_cast<size_t>(write + rest - first);
+            throw;
+        }
+        size_t removed = static_cast<size_t>(last - write);
+        //the tail bytes are stale copies or destroyed elements -> only the size has to shrink
+        v._size -= removed;
+        return removed;
+    }
+    else
+    {
+        T* new_end = std::remove_if(write, last, pred);
+        size_t removed = static_cast<size_t>(last - new_end);
+        v.erase(v.begin() + (new_end - first), v.end());
+        return removed;
+    }
+}
+
+//removes all elements equal to value, returns the number of removed elements
+template<typename T, typename Alloc, typename Growth, typename U>
+size_t erase(my_vector<T, Alloc, Growth>& v, const U& value)
+{
+    return erase_if(v, [&value](const T& elem){ return elem==value; });
+}
+
+}
@@ -0,0 +1,407 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#define MYSTL_HAS_VIRTUAL_MEMORY 1
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define MYSTL_HAS_VIRTUAL_MEMORY 1
+#else
+#define MYSTL_HAS_VIRTUAL_MEMORY 0
+#endif
+
+namespace mystl
+{
+
+namespace detail
+{
+
+//size of a base page, reservations and commits are done in whole pages
+inline size_t vm_page_size() noexcept
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwPageSize);
+#elif MYSTL_HAS_VIRTUAL_MEMORY
+    static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return page;
+#else
+    return 4096;
+#endif
+}
+
+//reserves bytes of address space without any memory behind it, every access faults until it is committed
+//returns nullptr if the range cant be reserved
+inline void* vm_reserve(size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+#elif MYSTL_HAS_VIRTUAL_MEMORY
+#ifdef MAP_NORESERVE
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+    void* p = ::mmap(nullptr, bytes, PROT_NONE, flags, -1, 0);
+    return (p==MAP_FAILED)?nullptr:p;
+#else
+    (void)bytes;
+    return nullptr;
+#endif
+}
+
+//makes bytes at p (page aligned, inside a reservation) readable and writable, pages are zero on first touch
+inline bool vm_commit(void* p, size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    return VirtualAlloc(p, bytes, MEM_COMMIT, PAGE_READWRITE)!=nullptr;
+#elif MYSTL_HAS_VIRTUAL_MEMORY
+    return ::mprotect(p, bytes, PROT_READ | PROT_WRITE)==0;
+#else
+    (void)p;
+    (void)bytes;
+    return false;
+#endif
+}
+
+//gives the memory behind bytes at p back to the system, the range stays reserved
+inline void vm_decommit(void* p, size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    VirtualFree(p, bytes, MEM_DECOMMIT);
+#elif MYSTL_HAS_VIRTUAL_MEMORY
+    ::madvise(p, bytes, MADV_DONTNEED);
+    ::mprotect(p, bytes, PROT_NONE);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+//frees a whole reservation from vm_reserve
+inline void vm_release(void* p, size_t bytes) noexcept
+{
+#if defined(_WIN32)
+    (void)bytes;
+    VirtualFree(p, 0, MEM_RELEASE);
+#elif MYSTL_HAS_VIRTUAL_MEMORY
+    ::munmap(p, bytes);
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+}
+
+//vector for append only data (logs, arenas of records) that never moves its elements
+//the first growth reserves address space for max_size() elements and pages get committed as the vector grows,
+//so push_back never copies the array and never invalidates pointers, references or iterators to existing elements
+//there is no 2x spike in time or memory while growing, only the size limit is fixed at construction
+//the reservation costs address space only (16 GiB by default, 128 TiB are available on x86-64 linux),
+//shrink_to_fit decommits the pages past the last element but keeps the reservation
+//iterators are raw pointers, they stay valid until their element is removed
+template<typename T>
+class vm_vector
+{
+    public:
+    using value_type = T;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    //address space reserved when no limit is given
+    static constexpr size_t default_reserve_bytes = size_t(16) << 30;
+
+    vm_vector() noexcept: vm_vector(default_reserve_bytes / sizeof(T)){}
+
+    //can hold up to max_elements, the address space is reserved on the first growth
+    explicit vm_vector(size_t max_elements) noexcept: _data(nullptr), _size(0), _cap(0), _max(max_elements){}
+
+    vm_vector(const vm_vector&) = delete;
+    vm_vector& operator = (const vm_vector&) = delete;
+
+    vm_vector(vm_vector&& other) noexcept: _data(other._data), _size(other._size), _cap(other._cap), _max(other._max)
+    {
+        other._data = nullptr;
+        other._size = 0;
+        other._cap = 0;
+    }
+
+    vm_vector& operator = (vm_vector&& other) noexcept
+    {
+        if(this!=&other)
+        {
+            free_storage();
+            _data = other._data;
+            _size = other._size;
+            _cap = other._cap;
+            _max = other._max;
+            other._data = nullptr;
+            other._size = 0;
+            other._cap = 0;
+        }
+        return *this;
+    }
+
+    ~vm_vector()
+    {
+        free_storage();
+    }
+
+    size_t size() const noexcept{return _size;}
+    //elements that fit in the committed pages
+    size_t capacity() const noexcept{return _cap;}
+    //elements that fit in the reservation, the vector can never grow beyond it
+    size_t max_size() const noexcept{return _max;}
+    bool empty() const noexcept{return _size==0;}
+
+    //commits pages for new_cap elements, throws std::length_error above max_size()
+    void reserve(size_t new_cap)
+    {
+        if(new_cap<=_cap) return;
+        commit(new_cap);
+    }
+
+    //decommits the pages past the last element, the elements dont move
+    void shrink_to_fit() noexcept
+    {
+        if(_data==nullptr) return;
+        size_t page = detail::vm_page_size();
+        size_t keep = round_up(_size * sizeof(T), page);
+        size_t committed = round_up(_cap * sizeof(T), page);
+        if(keep<committed) detail::vm_decommit(reinterpret_cast<char*>(_data) + keep, committed - keep);
+        //the last page may hold more elements than the reservation allows
+        size_t cap = keep / sizeof(T);
+        _cap = (cap>_max)?_max:cap;
+    }
+
+    //element access operator, only checked if MYSTL_BOUNDS_CHECK is on
+    T& operator[](size_t id)
+    {
+#if MYSTL_BOUNDS_CHECK
+        check_index(id);
+#endif
+        return _data[id];
+    }
+    const T& operator[](size_t id) const
+    {
+#if MYSTL_BOUNDS_CHECK
+        check_index(id);
+#endif
+        return _data[id];
+    }
+
+    //element access, always checked
+    T& at(size_t id)
+    {
+        check_index(id);
+        return _data[id];
+    }
+    const T& at(size_t id) const
+    {
+        check_index(id);
+        return _data[id];
+    }
+
+    void push_back(const T& val)
+    {
+        emplace_back(val);
+    }
+
+    void push_back(T&& val)
+    {
+        emplace_back(std::move(val));
+    }
+
+    //construct a new element at the end from args
+    //args may refer to elements of this vector, growing never moves them
+    template<typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if(_size==_cap) commit(grow_capacity(_size + 1));
+        T* elem = ::new(static_cast<void*>(_data + _size)) T(std::forward<Args>(args)...);
+        ++_size;
+        return *elem;
+    }
+
+    //resize, new elements are value initialized
+    void resize(size_t n)
+    {
+        resize_with(n, [](T* dest){ ::new(static_cast<void*>(dest)) T(); });
+    }
+
+    //resize, new elements are copies of value
+    void resize(size_t n, const T& value)
+    {
+        resize_with(n, [&value](T* dest){ ::new(static_cast<void*>(dest)) T(value); });
+    }
+
+    void pop_back()
+    {
+        if(_size==0)
+        {
+            throw std::out_of_range("tried to use pop_back on empty vector");
+        }
+        --_size;
+        _data[_size].~T();
+    }
+
+    //destroys all elements, the committed pages stay
+    void clear() noexcept
+    {
+        destroy(0);
+    }
+
+    T* data() noexcept{return _data;}
+    const T* data() const noexcept{return _data;}
+
+    iterator begin() noexcept{return _data;}
+    iterator end() noexcept{return _data + _size;}
+    const_iterator begin() const noexcept{return _data;}
+    const_iterator end() const noexcept{return _data + _size;}
+    const_iterator cbegin() const noexcept{return _data;}
+    const_iterator cend() const noexcept{return _data + _size;}
+
+    reverse_iterator rbegin() noexcept{return reverse_iterator(end());}
+    reverse_iterator rend() noexcept{return reverse_iterator(begin());}
+    const_reverse_iterator rbegin() const noexcept{return const_reverse_iterator(end());}
+    const_reverse_iterator rend() const noexcept{return const_reverse_iterator(begin());}
+    const_reverse_iterator crbegin() const noexcept{return const_reverse_iterator(end());}
+    const_reverse_iterator crend() const noexcept{return const_reverse_iterator(begin());}
+
+    private:
+    static size_t round_up(size_t bytes, size_t page) noexcept
+    {
+        return (bytes + page - 1) & ~(page - 1);
+    }
+
+    //committing is one syscall no matter how much -> commit ahead geometrically, but at most 64 MiB ahead,
+    //pages only take memory once they are touched
+    size_t grow_capacity(size_t needed) const noexcept
+    {
+        constexpr size_t min_commit = size_t(64) << 10;
+        constexpr size_t max_ahead = size_t(64) << 20;
+        size_t bytes = _cap * sizeof(T);
+        size_t ahead = (bytes<max_ahead)?bytes:max_ahead;
+        size_t target = bytes + ((ahead<min_commit)?min_commit:ahead);
+        size_t cap = target / sizeof(T);
+        if(cap<needed) cap = needed;
+        //commit throws if even needed doesnt fit
+        return (cap>_max && needed<=_max)?_max:cap;
+    }
+
+    //commits pages for at least new_cap elements, reserves the address space first if needed
+    void commit(size_t new_cap)
+    {
+        if(new_cap>_max || _max==0)
+        {
+            throw std::length_error("vm_vector grew beyond its reservation");
+        }
+        size_t page = detail::vm_page_size();
+        if(_data==nullptr)
+        {
+            if(_max>(static_cast<size_t>(-1) - page) / sizeof(T)) throw std::bad_alloc();
+            void* p = detail::vm_reserve(round_up(_max * sizeof(T), page));
+            if(p==nullptr) throw std::bad_alloc();
+            _data = static_cast<T*>(p);
+        }
+        size_t committed = round_up(_cap * sizeof(T), page);
+        size_t wanted = round_up(new_cap * sizeof(T), page);
+        if(wanted>committed && !detail::vm_commit(reinterpret_cast<char*>(_data) + committed, wanted - committed))
+        {
+            throw std::bad_alloc();
+        }
+        //the last page may hold more elements than asked for
+        size_t cap = wanted / sizeof(T);
+        _cap = (cap>_max)?_max:cap;
+    }
+
+    template<typename Construct>
+    void resize_with(size_t n, Construct construct)
+    {
+        if(n<=_size)
+        {
+            destroy(n);
+            return;
+        }
+        reserve(n);
+        size_t old_size = _size;
+        try
+        {
+            for(; _size<n; ++_size) construct(_data + _size);
+        }
+        catch(...)
+        {
+            destroy(old_size);
+            throw;
+        }
+    }
+
+    //destroys the elements from new_size on
+    void destroy(size_t new_size) noexcept
+    {
+        if constexpr(!std::is_trivially_destructible_v<T>)
+        {
+            for(size_t i = new_size; i<_size; i++) _data[i].~T();
+        }
+        _size = new_size;
+    }
+
+    void free_storage() noexcept
+    {
+        if(_data==nullptr) return;
+        destroy(0);
+        detail::vm_release(_data, round_up(_max * sizeof(T), detail::vm_page_size()));
+        _data = nullptr;
+        _cap = 0;
+    }
+
+    void check_index(size_t id) const
+    {
+        if(id>=_size)
+        {
+            throw std::out_of_range("tried to access out of bounds id");
+        }
+    }
+
+    T* _data;
+    size_t _size;
+    //elements in the committed pages
+    size_t _cap;
+    //elements in the reservation
+    size_t _max;
+};
+
+template<typename T>
+bool operator == (const vm_vector<T>& a, const vm_vector<T>& b)
+{
+    if(a.size()!=b.size()) return false;
+    for(size_t i = 0; i<a.size(); i++)
+    {
+        if(!(a[i]==b[i])) return false;
+    }
+    return true;
+}
+
+template<typename T>
+bool operator != (const vm_vector<T>& a, const vm_vector<T>& b)
+{
+    return !(a==b);
+}
+
+}
@@ -0,0 +1,103 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/aligned_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+bool is_aligned(const void* p, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+// cache line sized element, needs more than the default new alignment
+struct alignas(128) line {
+    int value = 0;
+    line() = default;
+    line(int v) : value(v) {}
+};
+
+// over-aligned and not trivially relocatable
+struct alignas(64) tagged {
+    std::string name;
+    tagged() = default;
+    tagged(std::string n) : name(std::move(n)) {}
+};
+} // namespace
+
+TEST_CASE("aligned over-aligned elements with std::allocator") {
+    mystl::my_vector<line> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(line(i));
+        REQUIRE(is_aligned(v.begin(), alignof(line)));
+    }
+    REQUIRE(v[999].value == 999);
+    v.shrink_to_fit();
+    REQUIRE(is_aligned(v.begin(), alignof(line)));
+}
+
+TEST_CASE("aligned over-aligned non trivial elements") {
+    mystl::my_vector<tagged> v;
+    for (int i = 0; i < 200; ++i) {
+        v.emplace(v.begin(), std::to_string(i));
+        REQUIRE(is_aligned(v.begin(), alignof(tagged)));
+    }
+    REQUIRE(v[0].name == "199");
+    REQUIRE(v[199].name == "0");
+}
+
+TEST_CASE("aligned buffer alignment after every growth step") {
+    mystl::aligned_vector<float, 64> v;
+    size_t cap = v.capacity();
+    int growths = 0;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(static_cast<float>(i));
+        if (v.capacity() != cap) {
+            cap = v.capacity();
+            ++growths;
+            REQUIRE(is_aligned(v.begin(), 64));
+        }
+    }
+    REQUIRE(growths > 5);
+    REQUIRE(v[99999] == 99999.0f);
+}
+
+TEST_CASE("aligned buffer alignment through every reallocating operation") {
+    mystl::aligned_vector<double, 128> v(3, 1.0);
+    REQUIRE(is_aligned(v.begin(), 128));
+    v.reserve(1000);
+    REQUIRE(is_aligned(v.begin(), 128));
+    v.insert(v.begin() + 1, 5000, 2.0);
+    REQUIRE(is_aligned(v.begin(), 128));
+    v.resize(20000);
+    REQUIRE(is_aligned(v.begin(), 128));
+    v.resize(10);
+    v.shrink_to_fit();
+    REQUIRE(is_aligned(v.begin(), 128));
+    mystl::aligned_vector<double, 128> copy(v);
+    REQUIRE(is_aligned(copy.begin(), 128));
+    REQUIRE(copy == v);
+}
+
+TEST_CASE("aligned capacity covers whole alignment blocks") {
+    mystl::aligned_vector<float, 64> v;
+    v.reserve(1);
+    // 64 bytes of floats
+    REQUIRE(v.capacity() == 16);
+    v.reserve(17);
+    REQUIRE(v.capacity() == 32);
+}
+
+TEST_CASE("aligned allocator uses the stronger of both alignments") {
+    STATIC_REQUIRE(mystl::aligned_allocator<float, 16>::alignment == 16);
+    STATIC_REQUIRE(mystl::aligned_allocator<line, 16>::alignment == 128);
+    mystl::aligned_vector<line, 16> v(10);
+    REQUIRE(is_aligned(v.begin(), 128));
+}
+
+TEST_CASE("aligned allocator takes no space") {
+    REQUIRE(sizeof(mystl::aligned_vector<float>) == sizeof(mystl::my_vector<float>));
+}
@@ -0,0 +1,344 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/malloc_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+// bookkeeping shared by all copies of a tracking_allocator
+struct arena_stats {
+    int allocations = 0;
+    int deallocations = 0;
+    long long live_elements = 0;
+};
+
+// stateful allocator, two instances are equal if they share the same stats
+template<typename T, bool Propagate>
+struct tracking_allocator {
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+    using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+    using propagate_on_container_swap = std::bool_constant<Propagate>;
+
+    template<typename U>
+    struct rebind {
+        using other = tracking_allocator<U, Propagate>;
+    };
+
+    arena_stats* stats;
+
+    explicit tracking_allocator(arena_stats* s) : stats(s) {}
+    template<typename U>
+    tracking_allocator(const tracking_allocator<U, Propagate>& other) : stats(other.stats) {}
+
+    T* allocate(size_t n) {
+        ++stats->allocations;
+        stats->live_elements += static_cast<long long>(n);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n) {
+        ++stats->deallocations;
+        stats->live_elements -= static_cast<long long>(n);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    friend bool operator==(const tracking_allocator& a, const tracking_allocator& b) { return a.stats == b.stats; }
+    friend bool operator!=(const tracking_allocator& a, const tracking_allocator& b) { return a.stats != b.stats; }
+};
+
+template<typename T>
+using propagating = tracking_allocator<T, true>;
+template<typename T>
+using non_propagating = tracking_allocator<T, false>;
+
+// allocator with a construct member, counts the elements it builds
+template<typename T>
+struct counting_construct_allocator : std::allocator<T> {
+    template<typename U>
+    struct rebind {
+        using other = counting_construct_allocator<U>;
+    };
+    counting_construct_allocator() = default;
+    template<typename U>
+    counting_construct_allocator(const counting_construct_allocator<U>&) {}
+
+    static inline int constructed = 0;
+    template<typename U, typename... Args>
+    void construct(U* p, Args&&... args) {
+        ++constructed;
+        ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+};
+} // namespace
+
+TEST_CASE("allocator stateless allocator takes no space") {
+    REQUIRE(sizeof(mystl::my_vector<int>) == sizeof(int*) + 2 * sizeof(size_t));
+    REQUIRE(sizeof(mystl::my_vector<int, mystl::malloc_allocator<int>>) == sizeof(mystl::my_vector<int>));
+    REQUIRE(sizeof(mystl::my_vector<int, propagating<int>>) > sizeof(mystl::my_vector<int>));
+}
+
+TEST_CASE("allocator every allocation goes through the allocator") {
+    arena_stats stats;
+    {
+        mystl::my_vector<std::string, propagating<std::string>> v{propagating<std::string>(&stats)};
+        for (int i = 0; i < 100; ++i) {
+            v.push_back(std::to_string(i));
+        }
+        v.insert(v.begin(), 50, "x");
+        v.shrink_to_fit();
+        REQUIRE(v.get_allocator().stats == &stats);
+        REQUIRE(stats.allocations > 0);
+    }
+    REQUIRE(stats.allocations == stats.deallocations);
+    REQUIRE(stats.live_elements == 0);
+}
+
+TEST_CASE("allocator extended constructors") {
+    arena_stats stats;
+    propagating<int> a(&stats);
+    mystl::my_vector<int, propagating<int>> v(5, 7, a);
+    REQUIRE(v.size() == 5);
+    REQUIRE(v[4] == 7);
+    mystl::my_vector<int, propagating<int>> w({1, 2, 3}, a);
+    REQUIRE(w.size() == 3);
+    mystl::my_vector<int, propagating<int>> z(10, a);
+    REQUIRE(z.size() == 10);
+    REQUIRE(z[9] == 0);
+    REQUIRE(stats.allocations == 3);
+}
+
+TEST_CASE("allocator copy construction keeps the allocator") {
+    arena_stats stats;
+    mystl::my_vector<int, propagating<int>> a({1, 2, 3}, propagating<int>(&stats));
+    mystl::my_vector<int, propagating<int>> b(a);
+    REQUIRE(b.get_allocator() == a.get_allocator());
+    REQUIRE(b == a);
+
+    arena_stats other;
+    mystl::my_vector<int, propagating<int>> c(a, propagating<int>(&other));
+    REQUIRE(c == a);
+    REQUIRE(other.allocations == 1);
+}
+
+TEST_CASE("allocator copy assignment propagates") {
+    arena_stats sa, sb;
+    mystl::my_vector<int, propagating<int>> a({1, 2, 3}, propagating<int>(&sa));
+    mystl::my_vector<int, propagating<int>> b({4, 5}, propagating<int>(&sb));
+    b = a;
+    REQUIRE(b == a);
+    REQUIRE(b.get_allocator().stats == &sa);
+    // the old block went back to its own allocator
+    REQUIRE(sb.live_elements == 0);
+}
+
+TEST_CASE("allocator copy assignment without propagation") {
+    arena_stats sa, sb;
+    mystl::my_vector<int, non_propagating<int>> a({1, 2, 3}, non_propagating<int>(&sa));
+    mystl::my_vector<int, non_propagating<int>> b({4, 5}, non_propagating<int>(&sb));
+    b = a;
+    REQUIRE(b == a);
+    REQUIRE(b.get_allocator().stats == &sb);
+}
+
+TEST_CASE("allocator move assignment propagates and steals") {
+    arena_stats sa, sb;
+    mystl::my_vector<int, propagating<int>> a({1, 2, 3}, propagating<int>(&sa));
+    mystl::my_vector<int, propagating<int>> b({4, 5}, propagating<int>(&sb));
+    const int* data = a.begin();
+    b = std::move(a);
+    REQUIRE(b.begin() == data);
+    REQUIRE(b.get_allocator().stats == &sa);
+    REQUIRE(sb.live_elements == 0);
+    REQUIRE(a.empty());
+}
+
+TEST_CASE("allocator move assignment with unequal allocators moves elements") {
+    arena_stats sa, sb;
+    mystl::my_vector<std::string, non_propagating<std::string>> a({"one", "two"}, non_propagating<std::string>(&sa));
+    mystl::my_vector<std::string, non_propagating<std::string>> b{non_propagating<std::string>(&sb)};
+    const std::string* data = a.begin();
+    b = std::move(a);
+    REQUIRE(b.size() == 2);
+    REQUIRE(b[1] == "two");
+    REQUIRE(b.begin() != data);
+    REQUIRE(b.get_allocator().stats == &sb);
+    REQUIRE(sb.allocations == 1);
+}
+
+TEST_CASE("allocator move assignment noexcept follows the traits") {
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<mystl::my_vector<int>>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<mystl::my_vector<int, propagating<int>>>);
+    STATIC_REQUIRE(!std::is_nothrow_move_assignable_v<mystl::my_vector<int, non_propagating<int>>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<mystl::my_vector<int, non_propagating<int>>>);
+}
+
+TEST_CASE("allocator move construction with an allocator") {
+    arena_stats sa, sb;
+    mystl::my_vector<int, non_propagating<int>> a({1, 2, 3}, non_propagating<int>(&sa));
+    const int* data = a.begin();
+    mystl::my_vector<int, non_propagating<int>> same(std::move(a), non_propagating<int>(&sa));
+    REQUIRE(same.begin() == data);
+    mystl::my_vector<int, non_propagating<int>> other(std::move(same), non_propagating<int>(&sb));
+    REQUIRE(other.size() == 3);
+    REQUIRE(other.begin() != data);
+    REQUIRE(sb.allocations == 1);
+}
+
+TEST_CASE("allocator swap propagates") {
+    arena_stats sa, sb;
+    mystl::my_vector<int, propagating<int>> a({1, 2, 3}, propagating<int>(&sa));
+    mystl::my_vector<int, propagating<int>> b({4, 5}, propagating<int>(&sb));
+    swap(a, b);
+    REQUIRE(a.size() == 2);
+    REQUIRE(a.get_allocator().stats == &sb);
+    REQUIRE(b.get_allocator().stats == &sa);
+}
+
+TEST_CASE("allocator construct member is used") {
+    counting_construct_allocator<int>::constructed = 0;
+    mystl::my_vector<int, counting_construct_allocator<int>> v;
+    v.push_back(1);
+    v.emplace_back(2);
+    mystl::my_vector<int, counting_construct_allocator<int>> w(v);
+    REQUIRE(w.size() == 2);
+    // copies of trivial types would be a memcpy with std::allocator
+    REQUIRE(counting_construct_allocator<int>::constructed == 4);
+}
+
+TEST_CASE("malloc_allocator uses the usable size of the block") {
+    mystl::my_vector<char, mystl::malloc_allocator<char>> v;
+    v.reserve(1);
+    REQUIRE(v.capacity() >= 1);
+    v.assign(100, 'a');
+    v.push_back('b');
+    REQUIRE(v.size() == 101);
+    REQUIRE(v[100] == 'b');
+}
+
+TEST_CASE("malloc_allocator reserve with smaller capacity") {
+    mystl::my_vector<int, mystl::malloc_allocator<int>> v;
+    v.reserve(10);
+    size_t cap = v.capacity();  // at least 10, the block may be a bit bigger
+    REQUIRE(cap >= 10);
+    v.reserve(5);
+    REQUIRE(v.capacity() == cap);
+}
+
+TEST_CASE("malloc_allocator grows relocatable elements with realloc") {
+    mystl::my_vector<std::unique_ptr<int>, mystl::malloc_allocator<std::unique_ptr<int>>> v;
+    for (int i = 0; i < 1000; ++i) {
+        v.push_back(std::make_unique<int>(i));
+        // the new element might come from the block that is about to move
+        v.push_back(std::make_unique<int>(*v[0]));
+    }
+    v.emplace(v.begin(), std::make_unique<int>(-1));
+    REQUIRE(v.size() == 2001);
+    REQUIRE(*v[0] == -1);
+    REQUIRE(*v[2000] == 0);
+    REQUIRE(*v[1999] == 999);
+    v.erase(v.begin(), v.begin() + 1000);
+    v.shrink_to_fit();
+    REQUIRE(v.size() == 1001);
+    REQUIRE(v.capacity() >= 1001);
+    REQUIRE(*v[1000] == 0);
+}
+
+TEST_CASE("malloc_allocator value initialized vectors start zeroed") {
+    STATIC_REQUIRE(mystl::is_zero_initializable_v<int>);
+    STATIC_REQUIRE(mystl::is_zero_initializable_v<double>);
+    STATIC_REQUIRE(mystl::is_zero_initializable_v<int*>);
+    STATIC_REQUIRE(!mystl::is_zero_initializable_v<std::string>);
+
+    // 1 GiB, calloc maps it lazily -> only the pages read here get touched
+    const size_t n = size_t(1) << 28;
+    mystl::my_vector<std::uint32_t, mystl::malloc_allocator<std::uint32_t>> counters(n);
+    REQUIRE(counters.size() == n);
+    REQUIRE(counters.capacity() >= n);
+    for (size_t i = 0; i < n; i += 999983) {
+        REQUIRE(counters[i] == 0);
+    }
+    REQUIRE(counters[n - 1] == 0);
+    counters[12345] = 7;
+    REQUIRE(counters[12345] == 7);
+}
+
+TEST_CASE("malloc_allocator resize of an emptied vector is zeroed again") {
+    mystl::my_vector<double, mystl::malloc_allocator<double>> v(100, 3.0);
+    v.clear();
+    v.resize(1000);
+    for (double x : v) {
+        REQUIRE(x == 0.0);
+    }
+    // growing a non empty vector keeps the old elements
+    v[0] = 1.0;
+    v.resize(5000);
+    REQUIRE(v[0] == 1.0);
+    REQUIRE(v[4999] == 0.0);
+}
+
+TEST_CASE("allocator release and adopt hand over the block") {
+    mystl::my_vector<std::string> v{"a", "b", "c"};
+    const std::string* data = v.data();
+    auto buffer = v.release();
+    REQUIRE(v.empty());
+    REQUIRE(v.capacity() == 0);
+    REQUIRE(v.data() == nullptr);
+    REQUIRE(buffer.ptr == data);
+    REQUIRE(buffer.size == 3);
+
+    mystl::my_vector<std::string> w(std::move(buffer));
+    REQUIRE(w.data() == data);
+    REQUIRE(w[2] == "c");
+    REQUIRE(buffer.ptr == nullptr);
+    w.push_back("d");
+    REQUIRE(w.size() == 4);
+}
+
+TEST_CASE("malloc_allocator adopts and releases C buffers") {
+    // a buffer a C decoder filled
+    const size_t n = 1000;
+    auto* raw = static_cast<int*>(std::malloc(n * sizeof(int)));
+    for (size_t i = 0; i < n; ++i) {
+        raw[i] = static_cast<int>(i);
+    }
+    mystl::my_vector<int, mystl::malloc_allocator<int>> v(mystl::adopt_buffer, raw, n, n);
+    REQUIRE(v.data() == raw);
+    REQUIRE(v[999] == 999);
+    // growing goes through realloc, which is fine for a malloc block
+    v.push_back(1000);
+    REQUIRE(v[1000] == 1000);
+
+    // and back to C, which frees it with free()
+    auto buffer = v.release();
+    REQUIRE(buffer.size == 1001);
+    REQUIRE(buffer.ptr[1000] == 1000);
+    std::free(buffer.ptr);
+}
+
+TEST_CASE("allocator conversion from and to std::vector") {
+    std::vector<int> ints{1, 2, 3};
+    mystl::my_vector<int> v(std::move(ints));
+    REQUIRE(v == mystl::my_vector<int>{1, 2, 3});
+    REQUIRE(ints.empty());
+
+    std::vector<std::string> strings{"x", "y"};
+    mystl::my_vector<std::string> copied(strings);
+    REQUIRE(copied.size() == 2);
+    REQUIRE(strings.size() == 2);
+    mystl::my_vector<std::string> moved(std::move(strings));
+    REQUIRE(moved[1] == "y");
+
+    std::vector<std::string> back = moved.to_std_vector();
+    REQUIRE(back == std::vector<std::string>{"x", "y"});
+    REQUIRE(moved.size() == 2);
+    back = std::move(moved).to_std_vector();
+    REQUIRE(back.size() == 2);
+    REQUIRE(moved.empty());
+}
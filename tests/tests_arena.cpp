@@ -0,0 +1,160 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/arena.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <string>
+
+namespace {
+bool is_aligned(const void* p, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+bool inside(const void* p, const void* first, size_t bytes) {
+    auto c = static_cast<const unsigned char*>(p);
+    auto f = static_cast<const unsigned char*>(first);
+    return c >= f && c < f + bytes;
+}
+
+template <typename T>
+using arena_vector = mystl::my_vector<T, mystl::arena_allocator<T>>;
+} // namespace
+
+TEST_CASE("arena allocations are aligned and dont overlap") {
+    mystl::monotonic_arena arena(256);
+    char* a = static_cast<char*>(arena.allocate(3, 1));
+    double* b = static_cast<double*>(arena.allocate(sizeof(double), alignof(double)));
+    void* c = arena.allocate(10, 64);
+    REQUIRE(is_aligned(b, alignof(double)));
+    REQUIRE(is_aligned(c, 64));
+    REQUIRE(reinterpret_cast<char*>(b) >= a + 3);
+    REQUIRE(static_cast<char*>(c) >= reinterpret_cast<char*>(b + 1));
+}
+
+TEST_CASE("arena uses the initial buffer before the heap") {
+    alignas(std::max_align_t) unsigned char buffer[1024];
+    mystl::monotonic_arena arena(buffer, sizeof(buffer));
+    void* p = arena.allocate(512);
+    REQUIRE(inside(p, buffer, sizeof(buffer)));
+    void* q = arena.allocate(1000);
+    REQUIRE_FALSE(inside(q, buffer, sizeof(buffer)));
+    // release goes back to the start of the buffer
+    arena.release();
+    REQUIRE(arena.allocate(16) == static_cast<void*>(buffer));
+}
+
+TEST_CASE("arena alignment padding at the end of the initial buffer") {
+    alignas(std::max_align_t) unsigned char buffer[100];
+    mystl::monotonic_arena arena(buffer, sizeof(buffer));
+    arena.allocate(98, 1);
+    // the padding for 8 byte alignment alone runs past the buffer
+    auto p = static_cast<unsigned char*>(arena.allocate(8, 8));
+    REQUIRE(is_aligned(p, 8));
+    REQUIRE_FALSE(inside(p, buffer, sizeof(buffer)));
+    REQUIRE_FALSE(inside(p + 7, buffer, sizeof(buffer)));
+    p[0] = 1;
+    p[7] = 2;
+    REQUIRE(arena.remaining() < (size_t(64) << 10));
+}
+
+TEST_CASE("arena chains blocks for allocations bigger than a block") {
+    mystl::monotonic_arena arena(128);
+    for (int i = 0; i < 100; ++i) {
+        auto p = static_cast<unsigned char*>(arena.allocate(1000));
+        p[0] = 1;
+        p[999] = 2;
+    }
+    void* big = arena.allocate(1 << 20);
+    REQUIRE(big != nullptr);
+    arena.release();
+    REQUIRE(arena.allocate(8) != nullptr);
+}
+
+TEST_CASE("arena grows the newest allocation in place") {
+    mystl::monotonic_arena arena(4096);
+    void* p = arena.allocate(100);
+    REQUIRE(arena.try_grow(p, 100, 200));
+    void* q = arena.allocate(10);
+    REQUIRE(static_cast<char*>(q) >= static_cast<char*>(p) + 200);
+    // p isnt the newest allocation any more
+    REQUIRE_FALSE(arena.try_grow(p, 200, 300));
+    // no room left in the block
+    REQUIRE_FALSE(arena.try_grow(q, 10, 1 << 20));
+}
+
+TEST_CASE("arena vector push_back") {
+    mystl::monotonic_arena arena;
+    arena_vector<int> v{mystl::arena_allocator<int>(arena)};
+    for (int i = 0; i < 100000; ++i) v.push_back(i);
+    REQUIRE(v.size() == 100000);
+    for (int i = 0; i < 100000; ++i) REQUIRE(v[i] == i);
+}
+
+TEST_CASE("arena vector grows in place when it is the newest allocation") {
+    mystl::monotonic_arena arena(1 << 16);
+    arena_vector<int> v{mystl::arena_allocator<int>(arena)};
+    v.reserve(16);
+    const int* first = v.data();
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    REQUIRE(v.data() == first);
+    v.shrink_to_fit();
+    REQUIRE(v.data() == first);
+    REQUIRE(v[999] == 999);
+}
+
+TEST_CASE("arena vectors growing side by side keep their elements") {
+    mystl::monotonic_arena arena(256);
+    mystl::arena_allocator<int> alloc(arena);
+    arena_vector<int> a(alloc);
+    arena_vector<int> b(alloc);
+    for (int i = 0; i < 5000; ++i) {
+        a.push_back(i);
+        b.push_back(-i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        REQUIRE(a[i] == i);
+        REQUIRE(b[i] == -i);
+    }
+}
+
+TEST_CASE("arena vector of non trivial elements") {
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    mystl::monotonic_arena arena(buffer, sizeof(buffer));
+    arena_vector<std::string> v{mystl::arena_allocator<std::string>(arena)};
+    for (int i = 0; i < 500; ++i) v.push_back(std::string(40, 'a' + i % 26));
+    v.insert(v.begin(), "front");
+    v.erase(v.begin() + 1);
+    REQUIRE(v.size() == 500);
+    REQUIRE(v[0] == "front");
+    REQUIRE(v[499] == std::string(40, 'a' + 499 % 26));
+}
+
+TEST_CASE("arena allocators compare by arena") {
+    mystl::monotonic_arena a;
+    mystl::monotonic_arena b;
+    mystl::arena_allocator<int> x(a);
+    mystl::arena_allocator<double> y(a);
+    mystl::arena_allocator<int> z(b);
+    REQUIRE(x == y);
+    REQUIRE(x != z);
+    STATIC_REQUIRE_FALSE(std::allocator_traits<mystl::arena_allocator<int>>::is_always_equal::value);
+}
+
+TEST_CASE("arena vector moves between arenas element by element") {
+    mystl::monotonic_arena a;
+    mystl::monotonic_arena b;
+    arena_vector<std::string> x{mystl::arena_allocator<std::string>(a)};
+    arena_vector<std::string> y{mystl::arena_allocator<std::string>(b)};
+    x.push_back("one");
+    x.push_back("two");
+    y = std::move(x);
+    // the allocator doesnt propagate -> y keeps its arena
+    REQUIRE(y.get_allocator().arena() == &b);
+    REQUIRE(y.size() == 2);
+    REQUIRE(y[1] == "two");
+    arena_vector<std::string> copy(y);
+    REQUIRE(copy.get_allocator().arena() == &b);
+    REQUIRE(copy == y);
+}
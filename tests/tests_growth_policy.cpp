@@ -0,0 +1,81 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/growth_policy.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+
+namespace {
+// counts how often capacity changes while pushing n elements
+template<typename Vec>
+int count_reallocations(Vec& v, int n) {
+    int reallocations = 0;
+    size_t cap = v.capacity();
+    for (int i = 0; i < n; ++i) {
+        v.push_back(i);
+        if (v.capacity() != cap) {
+            ++reallocations;
+            cap = v.capacity();
+        }
+    }
+    return reallocations;
+}
+}
+
+TEST_CASE("growth doubling") {
+    REQUIRE(mystl::growth::doubling::next_capacity(0, 1, 4) == 1);
+    REQUIRE(mystl::growth::doubling::next_capacity(8, 9, 4) == 16);
+    REQUIRE(mystl::growth::doubling::next_capacity(8, 100, 4) == 100);
+}
+
+TEST_CASE("growth one_and_half") {
+    REQUIRE(mystl::growth::one_and_half::next_capacity(0, 1, 4) == 1);
+    REQUIRE(mystl::growth::one_and_half::next_capacity(1, 2, 4) == 2);
+    REQUIRE(mystl::growth::one_and_half::next_capacity(100, 101, 4) == 151);
+}
+
+TEST_CASE("growth size_class fills the size class") {
+    // 1.5x of 10 ints is 16 ints = 64 bytes, already a size class
+    REQUIRE(mystl::growth::size_class::next_capacity(10, 11, 4) == 16);
+    // 3 byte elements: 16 elements = 48 bytes, exactly a 16 byte step
+    REQUIRE(mystl::growth::size_class::next_capacity(10, 11, 3) == 16);
+    // 151 ints = 604 bytes -> 640 byte class -> 160 ints
+    REQUIRE(mystl::growth::size_class::next_capacity(100, 101, 4) == 160);
+}
+
+TEST_CASE("growth page_rounded fills whole pages") {
+    size_t cap = mystl::growth::page_rounded::next_capacity(100, 101, 8);
+    REQUIRE(cap * 8 % 4096 == 0);
+    REQUIRE(cap == 512);
+    // elements that dont divide the page still get at least the required count
+    REQUIRE(mystl::growth::page_rounded::next_capacity(0, 1, 3000) == 1);
+}
+
+TEST_CASE("growth chunked switches to fixed increments") {
+    using policy = mystl::growth::chunked<1024, 4096>;
+    REQUIRE(policy::next_capacity(256, 257, 4) == 512);    // 1 KiB block -> still doubling
+    REQUIRE(policy::next_capacity(1024, 1025, 4) == 1280);  // 4 KiB block -> +256 elements
+    REQUIRE(policy::next_capacity(1024, 5000, 4) == 5000);
+}
+
+TEST_CASE("vector uses its growth policy") {
+    mystl::my_vector<int, std::allocator<int>, mystl::growth::one_and_half> a;
+    mystl::my_vector<int, std::allocator<int>, mystl::growth::doubling> b;
+    int ra = count_reallocations(a, 10000);
+    int rb = count_reallocations(b, 10000);
+    REQUIRE(a.size() == 10000);
+    REQUIRE(a[9999] == 9999);
+    REQUIRE(ra > rb);
+    REQUIRE(a.capacity() <= b.capacity());
+}
+
+TEST_CASE("vector with chunked growth") {
+    mystl::my_vector<std::uint64_t, std::allocator<std::uint64_t>, mystl::growth::chunked<4096>> v;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(i);
+    }
+    REQUIRE(v.size() == 10000);
+    // at most one increment (512 elements) of slack
+    REQUIRE(v.capacity() - v.size() < 512);
+}
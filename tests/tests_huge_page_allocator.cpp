@@ -0,0 +1,110 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/huge_page_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace {
+constexpr size_t huge = size_t(2) << 20;
+
+bool is_aligned(const void* p, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+// maps everything from 64 KiB on, so the tests dont need huge vectors
+template<typename T>
+using small_threshold = mystl::huge_page_allocator<T, 64 * 1024>;
+} // namespace
+
+TEST_CASE("huge page small vectors use the heap") {
+    mystl::my_vector<int, mystl::huge_page_allocator<int>> v{1, 2, 3};
+    REQUIRE(v.capacity() == 3);
+    REQUIRE(v[2] == 3);
+}
+
+TEST_CASE("huge page large blocks are aligned to huge pages") {
+    mystl::my_vector<float, small_threshold<float>> v;
+    for (int i = 0; i < 1000000; ++i) {
+        v.push_back(static_cast<float>(i));
+        if (v.capacity() * sizeof(float) >= 64 * 1024) {
+            REQUIRE(is_aligned(v.begin(), huge));
+            // mapped blocks are whole huge pages
+            REQUIRE(v.capacity() * sizeof(float) % huge == 0);
+        }
+    }
+    REQUIRE(v[999999] == 999999.0f);
+}
+
+TEST_CASE("huge page shrinking back to the heap") {
+    mystl::my_vector<std::uint64_t, small_threshold<std::uint64_t>> v(100000, 7);
+    REQUIRE(is_aligned(v.begin(), huge));
+    v.resize(10);
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 10);
+    REQUIRE(v[9] == 7);
+}
+
+TEST_CASE("huge page non trivial elements") {
+    mystl::my_vector<std::string, small_threshold<std::string>> v;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(std::to_string(i));
+    }
+    v.insert(v.begin(), "front");
+    REQUIRE(v[0] == "front");
+    REQUIRE(v[10000] == "9999");
+    mystl::my_vector<std::string, small_threshold<std::string>> copy(v);
+    REQUIRE(copy == v);
+}
+
+TEST_CASE("huge page growth remaps instead of copying") {
+    mystl::huge_page_stats before = mystl::huge_page_allocator<int>::stats();
+    mystl::my_vector<std::uint64_t, small_threshold<std::uint64_t>> v;
+    for (std::uint64_t i = 0; i < 2000000; ++i) {
+        v.push_back(i);
+        if (v.capacity() * sizeof(std::uint64_t) >= 64 * 1024) {
+            REQUIRE(is_aligned(v.begin(), huge));
+        }
+    }
+    for (std::uint64_t i = 0; i < 2000000; i += 9999) {
+        REQUIRE(v[i] == i);
+    }
+    mystl::huge_page_stats after = mystl::huge_page_allocator<int>::stats();
+#if defined(__linux__)
+    REQUIRE(after.remaps > before.remaps);
+    REQUIRE(after.bytes_not_copied > before.bytes_not_copied);
+#endif
+    // shrinking a mapped block remaps as well, crossing back below the threshold copies
+    v.resize(300000);
+    v.shrink_to_fit();
+    REQUIRE(v[299999] == 299999);
+    v.resize(100);
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 100);
+    REQUIRE(v[99] == 99);
+}
+
+TEST_CASE("huge page reallocate of non trivially copyable relocatable elements") {
+    mystl::my_vector<std::unique_ptr<int>, small_threshold<std::unique_ptr<int>>> v;
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(std::make_unique<int>(i));
+    }
+    v.emplace(v.begin() + 5, std::make_unique<int>(-5));
+    REQUIRE(*v[5] == -5);
+    REQUIRE(*v[100000] == 99999);
+}
+
+TEST_CASE("huge page value initialized vectors start zeroed") {
+    mystl::my_vector<std::uint64_t, small_threshold<std::uint64_t>> big(1000000);
+    REQUIRE(is_aligned(big.begin(), huge));
+    for (size_t i = 0; i < big.size(); i += 4093) {
+        REQUIRE(big[i] == 0);
+    }
+    mystl::my_vector<std::uint64_t, small_threshold<std::uint64_t>> small(100);
+    for (std::uint64_t x : small) {
+        REQUIRE(x == 0);
+    }
+}
@@ -0,0 +1,198 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/memory_resource.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <new>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+// counts what goes through it and passes it on to new_delete_resource
+class counting_resource : public mystl::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t deallocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t align) override {
+        ++allocations;
+        return mystl::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t align) override {
+        ++deallocations;
+        mystl::pmr::new_delete_resource()->deallocate(p, bytes, align);
+    }
+    bool do_is_equal(const mystl::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// one function for every strategy, the type doesnt change with the resource
+int fill_and_sum(mystl::pmr::my_vector<int>& v, int n) {
+    for (int i = 1; i <= n; ++i) v.push_back(i);
+    int sum = 0;
+    for (int x : v) sum += x;
+    return sum;
+}
+
+bool inside(const void* p, const void* first, size_t bytes) {
+    auto c = static_cast<const unsigned char*>(p);
+    auto f = static_cast<const unsigned char*>(first);
+    return c >= f && c < f + bytes;
+}
+} // namespace
+
+TEST_CASE("pmr vector uses the default resource") {
+    mystl::pmr::my_vector<int> v;
+    REQUIRE(v.get_allocator().resource() == mystl::pmr::get_default_resource());
+    REQUIRE(fill_and_sum(v, 100) == 5050);
+}
+
+TEST_CASE("pmr vector allocates from its resource") {
+    counting_resource counting;
+    {
+        mystl::pmr::my_vector<int> v(&counting);
+        REQUIRE(fill_and_sum(v, 1000) == 500500);
+        REQUIRE(counting.allocations > 0);
+    }
+    REQUIRE(counting.allocations == counting.deallocations);
+}
+
+TEST_CASE("pmr same function for every resource") {
+    mystl::pmr::monotonic_buffer_resource mono;
+    mystl::pmr::unsynchronized_pool_resource pool;
+    mystl::pmr::synchronized_pool_resource shared;
+    mystl::pmr::memory_resource* resources[] = {mystl::pmr::new_delete_resource(), &mono, &pool, &shared};
+    for (auto* r : resources) {
+        mystl::pmr::my_vector<int> v(r);
+        REQUIRE(fill_and_sum(v, 500) == 125250);
+    }
+}
+
+TEST_CASE("pmr monotonic buffer resource uses the buffer first") {
+    alignas(std::max_align_t) unsigned char buffer[4096];
+    mystl::pmr::monotonic_buffer_resource mono(buffer, sizeof(buffer));
+    mystl::pmr::my_vector<int> v(&mono);
+    v.reserve(100);
+    REQUIRE(inside(v.data(), buffer, sizeof(buffer)));
+    for (int i = 0; i < 10000; ++i) v.push_back(i);
+    REQUIRE_FALSE(inside(v.data(), buffer, sizeof(buffer)));
+    REQUIRE(v[9999] == 9999);
+}
+
+TEST_CASE("pmr null resource throws on allocation") {
+    mystl::pmr::my_vector<int> v(mystl::pmr::null_memory_resource());
+    REQUIRE_THROWS_AS(v.push_back(1), std::bad_alloc);
+    REQUIRE(v.empty());
+    // no allocation -> no throw
+    v.clear();
+    v.shrink_to_fit();
+}
+
+TEST_CASE("pmr null resource checks a hot path doesnt allocate") {
+    mystl::pmr::monotonic_buffer_resource setup;
+    mystl::pmr::my_vector<int> v(&setup);
+    v.reserve(64);
+    for (int i = 0; i < 64; ++i) v.push_back(i);
+    // a vector on the null resource keeps whatever the hot path does honest
+    mystl::pmr::my_vector<int> scratch(mystl::pmr::null_memory_resource());
+    REQUIRE_THROWS_AS(scratch.reserve(1), std::bad_alloc);
+    REQUIRE(v.size() == 64);
+}
+
+TEST_CASE("pmr pool resource reuses blocks") {
+    mystl::pmr::unsynchronized_pool_resource pool;
+    void* a = pool.allocate(24);
+    pool.deallocate(a, 24);
+    void* b = pool.allocate(30);
+    REQUIRE(a == b);
+    pool.deallocate(b, 30);
+    // big and over-aligned blocks bypass the pool
+    void* big = pool.allocate(100000);
+    void* aligned = pool.allocate(64, 256);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 256 == 0);
+    pool.deallocate(big, 100000);
+    pool.deallocate(aligned, 64, 256);
+}
+
+TEST_CASE("pmr pool resource release frees everything") {
+    mystl::pmr::unsynchronized_pool_resource pool;
+    std::set<void*> seen;
+    for (int i = 0; i < 10000; ++i) REQUIRE(seen.insert(pool.allocate(1 + i % 1024)).second);
+    pool.release();
+    REQUIRE(pool.allocate(16) != nullptr);
+}
+
+TEST_CASE("pmr synchronized pool resource from several threads") {
+    mystl::pmr::synchronized_pool_resource shared;
+    std::vector<std::thread> threads;
+    std::vector<int> sums(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&shared, &sums, t] {
+            for (int round = 0; round < 200; ++round) {
+                mystl::pmr::my_vector<int> v(&shared);
+                sums[t] = fill_and_sum(v, 50);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+    for (int s : sums) REQUIRE(s == 1275);
+}
+
+TEST_CASE("pmr allocator propagation") {
+    mystl::pmr::unsynchronized_pool_resource a;
+    mystl::pmr::unsynchronized_pool_resource b;
+    mystl::pmr::my_vector<std::string> x(&a);
+    mystl::pmr::my_vector<std::string> y(&b);
+    x.push_back("one");
+    x.push_back("two");
+    y = x;
+    REQUIRE(y.get_allocator().resource() == &b);
+    y = std::move(x);
+    REQUIRE(y.get_allocator().resource() == &b);
+    REQUIRE(y[1] == "two");
+    // copies start on the default resource like std::pmr containers
+    mystl::pmr::my_vector<std::string> copy(y);
+    REQUIRE(copy.get_allocator().resource() == mystl::pmr::get_default_resource());
+    mystl::pmr::my_vector<std::string> scoped(y, &a);
+    REQUIRE(scoped.get_allocator().resource() == &a);
+    REQUIRE(scoped == y);
+}
+
+TEST_CASE("pmr allocators compare by resource") {
+    mystl::pmr::unsynchronized_pool_resource a;
+    mystl::pmr::unsynchronized_pool_resource b;
+    mystl::pmr::polymorphic_allocator<int> x(&a);
+    mystl::pmr::polymorphic_allocator<double> y(&a);
+    mystl::pmr::polymorphic_allocator<int> z(&b);
+    REQUIRE(x == y);
+    REQUIRE(x != z);
+}
+
+TEST_CASE("pmr default resource can be replaced") {
+    counting_resource counting;
+    mystl::pmr::memory_resource* old = mystl::pmr::set_default_resource(&counting);
+    {
+        mystl::pmr::my_vector<int> v;
+        v.push_back(1);
+    }
+    mystl::pmr::set_default_resource(old);
+    REQUIRE(counting.allocations == 1);
+    REQUIRE(mystl::pmr::get_default_resource() == old);
+}
+
+#if MYSTL_HAS_STD_PMR
+TEST_CASE("pmr resources work with std::pmr containers") {
+    mystl::pmr::unsynchronized_pool_resource pool;
+    std::pmr::vector<int> sv(&pool);
+    for (int i = 0; i < 100; ++i) sv.push_back(i);
+    REQUIRE(sv[99] == 99);
+    std::pmr::monotonic_buffer_resource std_mono;
+    mystl::pmr::my_vector<int> v(&std_mono);
+    REQUIRE(fill_and_sum(v, 100) == 5050);
+}
+#endif
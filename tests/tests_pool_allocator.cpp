@@ -0,0 +1,137 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/pool_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+bool is_aligned(const void* p, size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+template <typename T>
+using pool_vector = mystl::my_vector<T, mystl::pool_allocator<T>>;
+} // namespace
+
+TEST_CASE("pool size classes") {
+    STATIC_REQUIRE(mystl::detail::pool_class_of(1) == 0);
+    STATIC_REQUIRE(mystl::detail::pool_class_of(16) == 0);
+    STATIC_REQUIRE(mystl::detail::pool_class_of(17) == 1);
+    STATIC_REQUIRE(mystl::detail::pool_class_of(1024) == mystl::detail::pool_class_count - 1);
+    STATIC_REQUIRE(mystl::detail::pool_block_size(mystl::detail::pool_class_of(100)) == 128);
+}
+
+TEST_CASE("pool allocate_at_least reports the size class") {
+    mystl::pool_allocator<int> alloc;
+    auto r = alloc.allocate_at_least(1);
+    REQUIRE(r.count == 4);
+    alloc.deallocate(r.ptr, r.count);
+    auto big = alloc.allocate_at_least(1000);
+    REQUIRE(big.count == 1000);
+    alloc.deallocate(big.ptr, big.count);
+}
+
+TEST_CASE("pool reuses freed blocks") {
+    mystl::pool_allocator<double> alloc;
+    double* p = alloc.allocate(3);
+    alloc.deallocate(p, 3);
+    double* q = alloc.allocate(3);
+    REQUIRE(q == p);
+    alloc.deallocate(q, 3);
+}
+
+TEST_CASE("pool blocks are distinct and aligned") {
+    mystl::pool_allocator<std::max_align_t> alloc;
+    std::set<void*> seen;
+    std::vector<std::max_align_t*> blocks;
+    for (int i = 0; i < 5000; ++i) {
+        std::max_align_t* p = alloc.allocate(1 + i % 8);
+        REQUIRE(is_aligned(p, alignof(std::max_align_t)));
+        REQUIRE(seen.insert(p).second);
+        blocks.push_back(p);
+    }
+    for (int i = 0; i < 5000; ++i) alloc.deallocate(blocks[i], 1 + i % 8);
+}
+
+TEST_CASE("pool tiny vectors grow in fewer steps") {
+    pool_vector<int> v;
+    v.push_back(1);
+    REQUIRE(v.capacity() == 4);
+    for (int i = 2; i <= 16; ++i) v.push_back(i);
+    REQUIRE(v.capacity() == 16);
+    for (int i = 0; i < 16; ++i) REQUIRE(v[i] == i + 1);
+}
+
+TEST_CASE("pool vector beyond the biggest size class") {
+    pool_vector<std::uint64_t> v;
+    for (std::uint64_t i = 0; i < 100000; ++i) v.push_back(i);
+    v.shrink_to_fit();
+    REQUIRE(v.size() == 100000);
+    REQUIRE(v[99999] == 99999);
+    v.resize(3);
+    v.shrink_to_fit();
+    REQUIRE(v[2] == 2);
+}
+
+TEST_CASE("pool vector of non trivial elements") {
+    pool_vector<std::string> v;
+    for (int i = 0; i < 100; ++i) v.insert(v.begin(), std::to_string(i));
+    REQUIRE(v[0] == "99");
+    REQUIRE(v[99] == "0");
+    pool_vector<std::string> copy(v);
+    REQUIRE(copy == v);
+}
+
+TEST_CASE("pool allocators are interchangeable") {
+    mystl::pool_allocator<int> a;
+    mystl::pool_allocator<double> b;
+    REQUIRE(a == b);
+    STATIC_REQUIRE(std::allocator_traits<mystl::pool_allocator<int>>::is_always_equal::value);
+    REQUIRE(sizeof(pool_vector<int>) == sizeof(mystl::my_vector<int>));
+}
+
+TEST_CASE("pool threads allocate and free concurrently") {
+    constexpr int thread_count = 4;
+    std::vector<std::thread> threads;
+    std::vector<int> ok(thread_count, 0);
+    for (int t = 0; t < thread_count; ++t) {
+        threads.emplace_back([t, &ok] {
+            bool good = true;
+            for (int round = 0; round < 200; ++round) {
+                std::vector<pool_vector<int>> vs(64);
+                for (int i = 0; i < 64; ++i)
+                    for (int j = 0; j <= i % 20; ++j) vs[i].push_back(t * 1000 + j);
+                for (int i = 0; i < 64; ++i)
+                    for (int j = 0; j <= i % 20; ++j) good = good && vs[i][j] == t * 1000 + j;
+            }
+            ok[t] = good;
+        });
+    }
+    for (auto& th : threads) th.join();
+    for (int t = 0; t < thread_count; ++t) REQUIRE(ok[t] == 1);
+}
+
+TEST_CASE("pool blocks freed on another thread") {
+    mystl::pool_allocator<int> alloc;
+    std::vector<int*> blocks;
+    for (int i = 0; i < 10000; ++i) {
+        int* p = alloc.allocate(2);
+        p[0] = i;
+        blocks.push_back(p);
+    }
+    std::thread other([&] {
+        for (int* p : blocks) alloc.deallocate(p, 2);
+    });
+    other.join();
+    // the other thread flushed its cache when it exited, the blocks are back in the depot
+    std::set<int*> reused;
+    for (int i = 0; i < 10000; ++i) reused.insert(alloc.allocate(2));
+    REQUIRE(reused.size() == 10000);
+    for (int* p : reused) alloc.deallocate(p, 2);
+}
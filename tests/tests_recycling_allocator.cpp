@@ -0,0 +1,158 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/recycling_allocator.hpp"
+#include "../source/vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace {
+template <typename T>
+using recycling_vector = mystl::my_vector<T, mystl::recycling_allocator<T>>;
+
+using ints = mystl::recycling_allocator<int>;
+
+// every test starts with an empty cache and the default limit
+void reset_cache() {
+    ints::trim();
+    ints::set_cache_limit(size_t(64) << 20);
+}
+} // namespace
+
+TEST_CASE("recycling bins are powers of two") {
+    STATIC_REQUIRE(mystl::detail::recycling_bin_of(1) == 0);
+    STATIC_REQUIRE(mystl::detail::recycling_bin_of(16) == 0);
+    STATIC_REQUIRE(mystl::detail::recycling_bin_of(17) == 1);
+    STATIC_REQUIRE(mystl::detail::recycling_block_size(mystl::detail::recycling_bin_of(1000)) == 1024);
+    ints alloc;
+    auto r = alloc.allocate_at_least(100);
+    REQUIRE(r.count == 128);
+    alloc.deallocate(r.ptr, r.count);
+    reset_cache();
+}
+
+TEST_CASE("recycling freed block is handed out again") {
+    reset_cache();
+    ints alloc;
+    mystl::recycling_stats before = ints::stats();
+    int* p = alloc.allocate(1000);
+    alloc.deallocate(p, 1000);
+    REQUIRE(ints::stats().bytes_cached == before.bytes_cached + 4096);
+    // any size of the same bin gets it
+    int* q = alloc.allocate(600);
+    REQUIRE(q == p);
+    mystl::recycling_stats after = ints::stats();
+    REQUIRE(after.misses == before.misses + 1);
+    REQUIRE(after.hits == before.hits + 1);
+    REQUIRE(after.bytes_cached == before.bytes_cached);
+    alloc.deallocate(q, 600);
+    reset_cache();
+}
+
+TEST_CASE("recycling bins are shared between element types") {
+    reset_cache();
+    mystl::recycling_allocator<std::uint64_t> wide;
+    mystl::recycling_allocator<char> narrow;
+    std::uint64_t* p = wide.allocate(64);
+    wide.deallocate(p, 64);
+    char* q = narrow.allocate(512);
+    REQUIRE(static_cast<void*>(q) == static_cast<void*>(p));
+    narrow.deallocate(q, 512);
+    reset_cache();
+}
+
+TEST_CASE("recycling vectors reuse each others buffers") {
+    reset_cache();
+    mystl::recycling_stats before = ints::stats();
+    for (int round = 0; round < 100; ++round) {
+        recycling_vector<int> v;
+        for (int i = 0; i < 5000; ++i) v.push_back(i);
+        REQUIRE(v[4999] == 4999);
+    }
+    mystl::recycling_stats after = ints::stats();
+    size_t hits = after.hits - before.hits;
+    size_t misses = after.misses - before.misses;
+    // only the first round misses
+    REQUIRE(misses < 20);
+    REQUIRE(hits > 99 * 10);
+    REQUIRE(after.hit_rate() > 0.9);
+    reset_cache();
+}
+
+TEST_CASE("recycling cache stays under the byte cap") {
+    reset_cache();
+    ints::set_cache_limit(10000);
+    ints alloc;
+    int* a = alloc.allocate(1024);
+    int* b = alloc.allocate(1024);
+    int* c = alloc.allocate(1024);
+    alloc.deallocate(a, 1024);
+    alloc.deallocate(b, 1024);
+    alloc.deallocate(c, 1024);
+    // two 4 KiB blocks fit, the third is freed
+    REQUIRE(ints::stats().bytes_cached == 8192);
+    int* big = alloc.allocate(100000);
+    alloc.deallocate(big, 100000);
+    REQUIRE(ints::stats().bytes_cached == 8192);
+    // lowering the cap trims right away
+    ints::set_cache_limit(4096);
+    REQUIRE(ints::stats().bytes_cached == 4096);
+    reset_cache();
+}
+
+TEST_CASE("recycling trim frees the cache") {
+    reset_cache();
+    ints alloc;
+    int* small = alloc.allocate(4);
+    int* large = alloc.allocate(4096);
+    alloc.deallocate(small, 4);
+    alloc.deallocate(large, 4096);
+    REQUIRE(ints::stats().bytes_cached == 16 + 16384);
+    // biggest blocks go first
+    ints::trim(100);
+    REQUIRE(ints::stats().bytes_cached == 16);
+    ints::trim();
+    REQUIRE(ints::stats().bytes_cached == 0);
+}
+
+TEST_CASE("recycling caches belong to their thread") {
+    reset_cache();
+    ints alloc;
+    int* p = alloc.allocate(256);
+    alloc.deallocate(p, 256);
+    size_t mine = ints::stats().bytes_cached;
+    mystl::recycling_stats other{};
+    std::thread t([&other] {
+        recycling_vector<int> v(100, 1);
+        other = ints::stats();
+    });
+    t.join();
+    REQUIRE(other.misses == 1);
+    REQUIRE(other.hits == 0);
+    REQUIRE(ints::stats().bytes_cached == mine);
+    reset_cache();
+}
+
+TEST_CASE("recycling blocks freed on another thread") {
+    reset_cache();
+    recycling_vector<std::string> v;
+    for (int i = 0; i < 1000; ++i) v.push_back(std::to_string(i));
+    // drop the blocks the growth left behind
+    ints::trim();
+    std::string last;
+    std::thread t([v = std::move(v), &last]() mutable {
+        last = v[999];
+        // freed into the cache of this thread, which is freed when it exits
+    });
+    t.join();
+    REQUIRE(last == "999");
+    REQUIRE(ints::stats().bytes_cached == 0);
+}
+
+TEST_CASE("recycling allocators are interchangeable") {
+    STATIC_REQUIRE(std::allocator_traits<ints>::is_always_equal::value);
+    REQUIRE(ints() == mystl::recycling_allocator<double>());
+    REQUIRE(sizeof(recycling_vector<int>) == sizeof(mystl::my_vector<int>));
+}
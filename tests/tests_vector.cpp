@@ -3,6 +3,16 @@
  */
 #include "../source/vector.hpp"
 #include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 TEST_CASE("vector default constructor") {
     mystl::my_vector<int> v;
@@ -121,7 +131,10 @@ TEST_CASE("vector push_back after exceeding reserved capacity") {
 TEST_CASE("vector access out of bounds") {
     mystl::my_vector<int> v;
     v.push_back(1);
-    REQUIRE_THROWS_AS(v[1], std::out_of_range);  // Expecting out-of-bounds access
+    REQUIRE_THROWS_AS(v.at(1), std::out_of_range);  // Expecting out-of-bounds access
+#if MYSTL_BOUNDS_CHECK
+    REQUIRE_THROWS_AS(v[1], std::out_of_range);  // operator[] only checks in hardened builds
+#endif
 }
 
 TEST_CASE("vector copy assignment empty to non-empty") {
@@ -213,7 +226,10 @@ TEST_CASE("vector access after pop_back") {
     v.pop_back();
     REQUIRE(v.size() == 1);
     REQUIRE(v[0] == 1);  // Valid access to the remaining element.
-    REQUIRE_THROWS_AS(v[1], std::out_of_range);  // Out-of-bounds access should throw
+    REQUIRE_THROWS_AS(v.at(1), std::out_of_range);  // Out-of-bounds access should throw
+#if MYSTL_BOUNDS_CHECK
+    REQUIRE_THROWS_AS(v[1], std::out_of_range);
+#endif
 }
 
 TEST_CASE("vector reserve with smaller capacity") {
@@ -234,4 +250,755 @@ TEST_CASE("vector move constructor and assignment") {
     REQUIRE(v2[1] == 20);
     REQUIRE(v1.size() == 0);  // v1 should be empty after move
     REQUIRE(v1.capacity() == 0);  // v1 should not hold any memory
-}
\ No newline at end of file
+}
+TEST_CASE("vector reserve keeps trivially copyable elements") {
+    struct pod { int a; double b; };
+    mystl::my_vector<pod> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(pod{i, i * 0.5});
+    }
+    v.reserve(1000);
+    REQUIRE(v.size() == 100);
+    REQUIRE(v.capacity() >= 1000);
+    REQUIRE(v[0].a == 0);
+    REQUIRE(v[99].a == 99);
+    REQUIRE(v[99].b == 49.5);
+}
+
+TEST_CASE("vector reserve keeps non-trivial elements") {
+    mystl::my_vector<std::string> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(std::string(40, 'a' + i % 26));  // long enough to live on the heap
+    }
+    v.reserve(1000);
+    REQUIRE(v.size() == 100);
+    REQUIRE(v[0] == std::string(40, 'a'));
+    REQUIRE(v[99] == std::string(40, 'a' + 99 % 26));
+}
+
+namespace {
+// counts move constructions so tests can see whether reserve relocated bitwise
+struct move_counter {
+    static inline int moves = 0;
+    int value;
+    explicit move_counter(int v) : value(v) {}
+    move_counter(const move_counter& other) : value(other.value) {}
+    move_counter(move_counter&& other) noexcept : value(other.value) { ++moves; }
+};
+}
+
+template<>
+struct mystl::is_trivially_relocatable<move_counter> : std::true_type {};
+
+TEST_CASE("vector trivially relocatable trait") {
+    STATIC_REQUIRE(mystl::is_trivially_relocatable_v<int>);
+    STATIC_REQUIRE(mystl::is_trivially_relocatable_v<std::unique_ptr<int>>);
+    STATIC_REQUIRE(mystl::is_trivially_relocatable_v<mystl::my_vector<std::string>>);
+    STATIC_REQUIRE_FALSE(mystl::is_trivially_relocatable_v<std::string>);
+}
+
+TEST_CASE("vector reserve relocates opted-in types without moving") {
+    mystl::my_vector<move_counter> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(move_counter(i));
+    }
+    move_counter::moves = 0;
+    v.reserve(1000);
+    REQUIRE(move_counter::moves == 0);
+    REQUIRE(v[0].value == 0);
+    REQUIRE(v[99].value == 99);
+}
+
+TEST_CASE("vector of vectors survives growth") {
+    mystl::my_vector<mystl::my_vector<int>> outer;
+    for (int i = 0; i < 1000; ++i) {
+        mystl::my_vector<int> inner;
+        inner.push_back(i);
+        inner.push_back(i * 2);
+        outer.push_back(std::move(inner));
+    }
+    REQUIRE(outer.size() == 1000);
+    REQUIRE(outer[0][1] == 0);
+    REQUIRE(outer[999][0] == 999);
+    REQUIRE(outer[999][1] == 1998);
+}
+
+TEST_CASE("vector of unique_ptr survives growth") {
+    mystl::my_vector<std::unique_ptr<int>> v;
+    for (int i = 0; i < 100; ++i) {
+        v.push_back(std::make_unique<int>(i));
+    }
+    REQUIRE(*v[0] == 0);
+    REQUIRE(*v[99] == 99);
+}
+
+TEST_CASE("vector emplace_back constructs in place") {
+    mystl::my_vector<std::pair<int, std::string>> v;
+    auto& ref = v.emplace_back(1, "one");
+    REQUIRE(ref.first == 1);
+    v.emplace_back(2, "two");
+    REQUIRE(v.size() == 2);
+    REQUIRE(v[1].second == "two");
+}
+
+TEST_CASE("vector emplace_back of own element while growing") {
+    mystl::my_vector<std::string> v;
+    v.push_back(std::string(40, 'x'));
+    while (v.size() < v.capacity()) {
+        v.push_back("filler");
+    }
+    size_t n = v.size();
+    v.emplace_back(v[0]);  // reallocates, the argument lives in the old storage
+    REQUIRE(v.size() == n + 1);
+    REQUIRE(v[n] == std::string(40, 'x'));
+}
+
+TEST_CASE("vector push_back of own element while growing relocatable type") {
+    mystl::my_vector<int> v{7};
+    while (v.size() < v.capacity()) {
+        v.push_back(0);
+    }
+    size_t n = v.size();
+    v.push_back(v[0]);  // realloc may move the block the argument lives in
+    REQUIRE(v.size() == n + 1);
+    REQUIRE(v[n] == 7);
+}
+
+TEST_CASE("vector emplace at front, middle and end") {
+    mystl::my_vector<std::string> v;
+    v.reserve(10);
+    v.emplace(v.begin(), "b");
+    v.emplace(v.begin(), "a");
+    v.emplace(v.end(), "d");
+    auto it = v.emplace(v.begin() + 2, "c");
+    REQUIRE(*it == "c");
+    REQUIRE(v.size() == 4);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[1] == "b");
+    REQUIRE(v[2] == "c");
+    REQUIRE(v[3] == "d");
+}
+
+TEST_CASE("vector emplace with reallocation") {
+    mystl::my_vector<int> v;
+    v.reserve(4);
+    while (v.size() < v.capacity()) {
+        v.push_back(static_cast<int>(v.size()));
+    }
+    size_t n = v.size();
+    v.emplace(v.begin() + 1, 42);
+    REQUIRE(v.size() == n + 1);
+    REQUIRE(v[0] == 0);
+    REQUIRE(v[1] == 42);
+    REQUIRE(v[2] == 1);
+    REQUIRE(v[n] == static_cast<int>(n) - 1);
+}
+
+TEST_CASE("vector emplace of own element") {
+    mystl::my_vector<std::string> v;
+    v.reserve(10);
+    v.push_back("first");
+    v.push_back("second");
+    v.emplace(v.begin(), v[1]);  // the argument gets shifted by the insertion
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[0] == "second");
+    REQUIRE(v[1] == "first");
+    REQUIRE(v[2] == "second");
+}
+
+TEST_CASE("vector n element constructor") {
+    mystl::my_vector<std::string> v(5);
+    REQUIRE(v.size() == 5);
+    REQUIRE(v.capacity() >= 5);
+    REQUIRE(v[4].empty());
+
+    mystl::my_vector<int> zeros(100);
+    REQUIRE(zeros[0] == 0);
+    REQUIRE(zeros[99] == 0);
+}
+
+TEST_CASE("vector initializer list constructor") {
+    mystl::my_vector<int> v{1, 2, 3};
+    REQUIRE(v.size() == 3);
+    REQUIRE(v.capacity() >= 3);
+    REQUIRE(v[0] == 1);
+    REQUIRE(v[2] == 3);
+}
+
+TEST_CASE("vector n copies constructor") {
+    mystl::my_vector<int> v(5, 3);  // must not be taken for an iterator range
+    REQUIRE(v.size() == 5);
+    REQUIRE(v[0] == 3);
+    REQUIRE(v[4] == 3);
+}
+
+TEST_CASE("vector range constructor from forward iterators allocates once") {
+    std::list<std::string> src{"a", "b", "c", "d", "e"};
+    mystl::my_vector<std::string> v(src.begin(), src.end());
+    REQUIRE(v.size() == 5);
+    REQUIRE(v.capacity() >= 5);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[4] == "e");
+}
+
+TEST_CASE("vector range constructor from input iterators") {
+    std::istringstream in("1 2 3 4 5 6 7");
+    mystl::my_vector<int> v{std::istream_iterator<int>(in), std::istream_iterator<int>()};
+    REQUIRE(v.size() == 7);
+    REQUIRE(v[0] == 1);
+    REQUIRE(v[6] == 7);
+}
+
+TEST_CASE("vector range constructor with converting elements") {
+    std::vector<int> src{1, 2, 3};
+    mystl::my_vector<long long> v(src.begin(), src.end());
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[2] == 3);
+}
+
+TEST_CASE("vector assign range") {
+    mystl::my_vector<int> v{9, 9};
+    int src[] = {1, 2, 3, 4};
+    v.assign(src, src + 4);
+    REQUIRE(v.size() == 4);
+    REQUIRE(v[0] == 1);
+    REQUIRE(v[3] == 4);
+
+    size_t cap = v.capacity();
+    v.assign({7});
+    REQUIRE(v.size() == 1);
+    REQUIRE(v[0] == 7);
+    REQUIRE(v.capacity() == cap);  // shrinking assign keeps the block
+}
+
+TEST_CASE("vector assign n copies") {
+    mystl::my_vector<std::string> v{"a", "b", "c"};
+    v.assign(2, "x");
+    REQUIRE(v.size() == 2);
+    REQUIRE(v[0] == "x");
+    REQUIRE(v[1] == "x");
+
+    v.assign(4, "y");
+    REQUIRE(v.size() == 4);
+    REQUIRE(v[3] == "y");
+}
+
+TEST_CASE("vector assign n copies of own element") {
+    mystl::my_vector<std::string> v{std::string(40, 'q')};
+    v.assign(10, v[0]);  // grows, the value lives in the old storage
+    REQUIRE(v.size() == 10);
+    REQUIRE(v[9] == std::string(40, 'q'));
+}
+
+TEST_CASE("vector resize grows with value initialized elements") {
+    mystl::my_vector<int> v{1, 2};
+    v.resize(5);
+    REQUIRE(v.size() == 5);
+    REQUIRE(v[1] == 2);
+    REQUIRE(v[2] == 0);
+    REQUIRE(v[4] == 0);
+}
+
+TEST_CASE("vector resize shrinks and keeps capacity") {
+    mystl::my_vector<std::string> v{"a", "b", "c", "d"};
+    v.resize(2);
+    REQUIRE(v.size() == 2);
+    REQUIRE(v.capacity() == 4);
+    REQUIRE(v[1] == "b");
+}
+
+TEST_CASE("vector resize with value") {
+    mystl::my_vector<std::string> v{"a"};
+    v.resize(3, "z");
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[2] == "z");
+
+    v.resize(10, v[0]);  // grows, the value lives in the old storage
+    REQUIRE(v.size() == 10);
+    REQUIRE(v[9] == "a");
+}
+
+TEST_CASE("vector resize grows geometrically") {
+    mystl::my_vector<int> v;
+    v.resize(8);
+    size_t cap = v.capacity();
+    v.resize(cap + 1);
+    REQUIRE(v.capacity() >= 2 * cap);
+}
+
+TEST_CASE("vector resize_default_init") {
+    mystl::my_vector<float> v;
+    v.resize_default_init(1000);
+    REQUIRE(v.size() == 1000);
+    REQUIRE(v.capacity() >= 1000);
+    v[999] = 1.5f;
+    REQUIRE(v[999] == 1.5f);
+
+    // non-trivial types still get constructed
+    mystl::my_vector<std::string> s;
+    s.resize_default_init(3);
+    REQUIRE(s.size() == 3);
+    REQUIRE(s[2].empty());
+}
+
+TEST_CASE("vector default_init constructor") {
+    mystl::my_vector<double> v(100, mystl::default_init);
+    REQUIRE(v.size() == 100);
+    REQUIRE(v.capacity() >= 100);
+}
+
+TEST_CASE("vector insert single element") {
+    mystl::my_vector<int> v{1, 3};
+    auto it = v.insert(v.begin() + 1, 2);
+    REQUIRE(*it == 2);
+    v.insert(v.end(), 4);
+    v.insert(v.begin(), 0);
+    REQUIRE(v.size() == 5);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(v[i] == i);
+    }
+}
+
+TEST_CASE("vector insert n copies") {
+    mystl::my_vector<std::string> v{"a", "d"};
+    v.reserve(10);
+    v.insert(v.begin() + 1, 2, "x");
+    REQUIRE(v.size() == 4);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[1] == "x");
+    REQUIRE(v[2] == "x");
+    REQUIRE(v[3] == "d");
+
+    v.insert(v.begin(), 3, v[3]);  // value is shifted by its own insertion
+    REQUIRE(v.size() == 7);
+    REQUIRE(v[0] == "d");
+    REQUIRE(v[2] == "d");
+    REQUIRE(v[3] == "a");
+}
+
+TEST_CASE("vector insert range grows once") {
+    mystl::my_vector<int> v{1, 5};
+    std::list<int> src{2, 3, 4};
+    v.insert(v.begin() + 1, src.begin(), src.end());
+    REQUIRE(v.size() == 5);
+    REQUIRE(v.capacity() >= 5);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(v[i] == i + 1);
+    }
+}
+
+TEST_CASE("vector insert range of non-relocatable type") {
+    // std::string is not marked trivially relocatable -> exercises the move_backward path
+    mystl::my_vector<std::string> v{"a", "b", "c", "d", "e"};
+    v.reserve(20);
+    v.insert(v.begin() + 1, {"x", "y"});  // fewer new elements than elements after pos
+    REQUIRE(v.size() == 7);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[1] == "x");
+    REQUIRE(v[2] == "y");
+    REQUIRE(v[3] == "b");
+    REQUIRE(v[6] == "e");
+
+    v.insert(v.begin() + 5, {"1", "2", "3", "4"});  // new elements reach past the old end
+    REQUIRE(v.size() == 11);
+    REQUIRE(v[4] == "c");
+    REQUIRE(v[5] == "1");
+    REQUIRE(v[8] == "4");
+    REQUIRE(v[9] == "d");
+    REQUIRE(v[10] == "e");
+}
+
+TEST_CASE("vector insert range from input iterators") {
+    mystl::my_vector<int> v{1, 5};
+    std::istringstream in("2 3 4");
+    v.insert(v.begin() + 1, std::istream_iterator<int>(in), std::istream_iterator<int>());
+    REQUIRE(v.size() == 5);
+    for (int i = 0; i < 5; ++i) {
+        REQUIRE(v[i] == i + 1);
+    }
+}
+
+TEST_CASE("vector erase single element") {
+    mystl::my_vector<std::string> v{"a", "b", "c"};
+    auto it = v.erase(v.begin() + 1);
+    REQUIRE(*it == "c");
+    REQUIRE(v.size() == 2);
+    REQUIRE(v[0] == "a");
+    REQUIRE(v[1] == "c");
+    REQUIRE_THROWS_AS(v.erase(v.end()), std::out_of_range);
+}
+
+TEST_CASE("vector erase range") {
+    mystl::my_vector<int> v{0, 1, 2, 3, 4, 5};
+    auto it = v.erase(v.begin() + 1, v.begin() + 4);
+    REQUIRE(*it == 4);
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[0] == 0);
+    REQUIRE(v[1] == 4);
+    REQUIRE(v[2] == 5);
+    REQUIRE(v.erase(v.begin(), v.begin()) == v.begin());
+}
+
+TEST_CASE("vector erase_if and erase") {
+    mystl::my_vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    REQUIRE(mystl::erase_if(v, [](int x) { return x % 3 == 0; }) == 4);
+    REQUIRE(v.size() == 6);
+    REQUIRE(v[0] == 1);
+    REQUIRE(v[1] == 2);
+    REQUIRE(v[2] == 4);
+    REQUIRE(v[5] == 8);
+
+    mystl::my_vector<std::string> s{"a", "b", "a", "c"};
+    REQUIRE(mystl::erase(s, "a") == 2);
+    REQUIRE(s.size() == 2);
+    REQUIRE(s[0] == "b");
+    REQUIRE(s[1] == "c");
+}
+
+TEST_CASE("vector erase_if calls pred once per element") {
+    mystl::my_vector<std::unique_ptr<int>> v;
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(std::make_unique<int>(i));
+    }
+    int calls = 0;
+    size_t removed = mystl::erase_if(v, [&calls](const std::unique_ptr<int>& p) {
+        ++calls;
+        return *p >= 3 && *p < 6;
+    });
+    REQUIRE(removed == 3);
+    REQUIRE(calls == 10);
+    REQUIRE(v.size() == 7);
+    REQUIRE(*v[2] == 2);
+    REQUIRE(*v[3] == 6);
+}
+
+TEST_CASE("vector at checks bounds") {
+    const mystl::my_vector<int> v{1, 2, 3};
+    REQUIRE(v.at(0) == 1);
+    REQUIRE(v.at(2) == 3);
+    REQUIRE_THROWS_AS(v.at(3), std::out_of_range);
+}
+
+namespace {
+// copy throws once the countdown runs out, move is not noexcept so growth has to copy
+struct throwing_copy {
+    static inline int copies_left = 1000;
+    int value;
+    explicit throwing_copy(int v) : value(v) {}
+    throwing_copy(const throwing_copy& other) : value(other.value) {
+        if (copies_left-- <= 0) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    throwing_copy(throwing_copy&& other) : value(other.value) { other.value = -1; }
+    throwing_copy& operator=(const throwing_copy&) = default;
+};
+}
+
+namespace {
+// counts live instances, move assignment throws once the countdown runs out
+struct throwing_assign {
+    static inline int live = 0;
+    static inline int assigns_left = 1000;
+    int value;
+    explicit throwing_assign(int v) : value(v) { ++live; }
+    throwing_assign(const throwing_assign& other) : value(other.value) { ++live; }
+    throwing_assign(throwing_assign&& other) : value(other.value) { ++live; }
+    throwing_assign& operator=(throwing_assign&& other) {
+        if (assigns_left-- <= 0) {
+            throw std::runtime_error("assignment failed");
+        }
+        value = other.value;
+        return *this;
+    }
+    ~throwing_assign() { --live; }
+};
+}
+
+TEST_CASE("vector emplace destroys every element when an assignment throws") {
+    throwing_assign::live = 0;
+    {
+        mystl::my_vector<throwing_assign> v;
+        v.reserve(10);
+        for (int i = 0; i < 4; ++i) {
+            v.emplace_back(i);
+        }
+        throwing_assign::assigns_left = 1;
+        REQUIRE_THROWS_AS(v.emplace(v.begin() + 1, 9), std::runtime_error);
+        throwing_assign::assigns_left = 1000;
+        // the tail element built before the throw belongs to the vector
+        REQUIRE(v.size() == 5);
+        REQUIRE(throwing_assign::live == 5);
+    }
+    REQUIRE(throwing_assign::live == 0);
+}
+
+TEST_CASE("vector move operations are noexcept") {
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<mystl::my_vector<int>>);
+    STATIC_REQUIRE(std::is_nothrow_move_assignable_v<mystl::my_vector<int>>);
+    STATIC_REQUIRE(std::is_nothrow_swappable_v<mystl::my_vector<int>>);
+}
+
+TEST_CASE("vector swap") {
+    mystl::my_vector<int> a{1, 2, 3};
+    mystl::my_vector<int> b{4};
+    const int* a_data = &a[0];
+    using std::swap;
+    swap(a, b);
+    REQUIRE(a.size() == 1);
+    REQUIRE(a[0] == 4);
+    REQUIRE(b.size() == 3);
+    REQUIRE(&b[0] == a_data);
+}
+
+TEST_CASE("vector reserve has the strong guarantee") {
+    mystl::my_vector<throwing_copy> v;
+    v.reserve(4);
+    for (int i = 0; i < 4; ++i) {
+        v.emplace_back(i);
+    }
+    size_t cap = v.capacity();
+    throwing_copy::copies_left = 2;
+    REQUIRE_THROWS_AS(v.reserve(100), std::runtime_error);
+    throwing_copy::copies_left = 1000;
+    // nothing was moved from and the old block is still in use
+    REQUIRE(v.capacity() == cap);
+    REQUIRE(v.size() == 4);
+    for (int i = 0; i < 4; ++i) {
+        REQUIRE(v[i].value == i);
+    }
+}
+
+TEST_CASE("vector push_back has the strong guarantee when growing") {
+    mystl::my_vector<throwing_copy> v;
+    v.reserve(4);
+    while (v.size() < v.capacity()) {
+        v.emplace_back(static_cast<int>(v.size()));
+    }
+    size_t cap = v.capacity();
+    throwing_copy::copies_left = 3;
+    REQUIRE_THROWS_AS(v.emplace_back(-1), std::runtime_error);
+    throwing_copy::copies_left = 1000;
+    REQUIRE(v.capacity() == cap);
+    REQUIRE(v.size() == cap);
+    REQUIRE(v[0].value == 0);
+    REQUIRE(v[cap - 1].value == static_cast<int>(cap) - 1);
+}
+
+TEST_CASE("vector shrink_to_fit") {
+    mystl::my_vector<int> v;
+    v.reserve(1000);
+    for (int i = 0; i < 10; ++i) {
+        v.push_back(i);
+    }
+    v.shrink_to_fit();
+    REQUIRE(v.size() == 10);
+    REQUIRE(v.capacity() >= 10);
+    REQUIRE(v.capacity() < 1000);
+    REQUIRE(v[9] == 9);
+
+    v.clear();
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 0);
+}
+
+TEST_CASE("vector shrink_to_fit non-relocatable type") {
+    mystl::my_vector<std::string> v;
+    v.reserve(100);
+    v.push_back("a");
+    v.push_back("b");
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() < 100);
+    REQUIRE(v[1] == "b");
+}
+
+TEST_CASE("vector slack_bytes") {
+    mystl::my_vector<double> v;
+    REQUIRE(v.slack_bytes() == 0);
+    v.reserve(10);
+    v.push_back(1.0);
+    REQUIRE(v.slack_bytes() == (v.capacity() - 1) * sizeof(double));
+    REQUIRE(v.slack_bytes() >= 9 * sizeof(double));
+}
+
+TEST_CASE("vector copy assignment reuses capacity and elements") {
+    mystl::my_vector<std::string> src{std::string(100, 'a'), std::string(100, 'b')};
+    mystl::my_vector<std::string> dst{std::string(100, 'x'), std::string(100, 'y'), std::string(100, 'z')};
+    const std::string* block = &dst[0];
+    const char* first_buffer = dst[0].data();
+
+    dst = src;
+    REQUIRE(dst.size() == 2);
+    REQUIRE(dst[0] == std::string(100, 'a'));
+    REQUIRE(dst[1] == std::string(100, 'b'));
+    REQUIRE(&dst[0] == block);              // no new block
+    REQUIRE(dst[0].data() == first_buffer);  // the string was assigned over, not rebuilt
+}
+
+TEST_CASE("vector copy assignment constructs the tail") {
+    mystl::my_vector<std::string> src{"a", "b", "c", "d"};
+    mystl::my_vector<std::string> dst;
+    dst.reserve(10);
+    dst.push_back("x");
+    dst = src;
+    REQUIRE(dst.size() == 4);
+    REQUIRE(dst[0] == "a");
+    REQUIRE(dst[3] == "d");
+}
+
+TEST_CASE("vector copy assignment of trivial type into bigger vector") {
+    mystl::my_vector<int> src{1, 2};
+    mystl::my_vector<int> dst{5, 6, 7, 8};
+    dst = src;
+    REQUIRE(dst.size() == 2);
+    REQUIRE(dst[0] == 1);
+    REQUIRE(dst[1] == 2);
+}
+
+TEST_CASE("vector assign from input iterators reuses elements") {
+    mystl::my_vector<int> v{9, 9, 9, 9, 9};
+    std::istringstream in("1 2 3");
+    v.assign(std::istream_iterator<int>(in), std::istream_iterator<int>());
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[0] == 1);
+    REQUIRE(v[2] == 3);
+
+    std::istringstream longer("1 2 3 4 5 6 7 8");
+    v.assign(std::istream_iterator<int>(longer), std::istream_iterator<int>());
+    REQUIRE(v.size() == 8);
+    REQUIRE(v[7] == 8);
+}
+
+TEST_CASE("vector comparison on const vectors") {
+    const mystl::my_vector<int> a{1, 2, 3};
+    const mystl::my_vector<int> b{1, 2, 3};
+    const mystl::my_vector<int> c{1, 2, 4};
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(a < c);
+    REQUIRE(c > a);
+    REQUIRE(a <= b);
+    REQUIRE(a >= b);
+}
+
+TEST_CASE("vector equality finds late differences") {
+    mystl::my_vector<std::uint32_t> a(1000);
+    mystl::my_vector<std::uint32_t> b(1000);
+    REQUIRE(a == b);
+    b[999] = 1;
+    REQUIRE(a != b);
+    REQUIRE(a < b);
+    a[700] = 5;
+    REQUIRE(b < a);
+}
+
+TEST_CASE("vector equality of floating point is not bitwise") {
+    mystl::my_vector<double> a{0.0};
+    mystl::my_vector<double> b{-0.0};
+    REQUIRE(a == b);
+}
+
+TEST_CASE("vector lexicographic ordering") {
+    using bytes = mystl::my_vector<unsigned char>;
+    REQUIRE(bytes{1, 2} < bytes{1, 2, 0});  // prefix comes first
+    REQUIRE(bytes{1, 200} > bytes{1, 2, 3});
+    REQUIRE_FALSE(bytes{} < bytes{});
+
+    using ints = mystl::my_vector<int>;
+    REQUIRE(ints{-1} < ints{1});  // signed order, not byte order
+    REQUIRE(ints{256} > ints{1, 0});
+
+    using strings = mystl::my_vector<std::string>;
+    REQUIRE(strings{"a", "b"} < strings{"a", "c"});
+}
+
+TEST_CASE("vector as std::map key") {
+    std::map<mystl::my_vector<std::uint32_t>, int> counts;
+    counts[{1, 2, 3}]++;
+    counts[{1, 2, 3}]++;
+    counts[{1, 2}]++;
+    REQUIRE(counts.size() == 2);
+    REQUIRE(counts[{1, 2, 3}] == 2);
+    REQUIRE(counts.begin()->first == mystl::my_vector<std::uint32_t>{1, 2});
+}
+
+TEST_CASE("vector push_back_unchecked after reserve") {
+    mystl::my_vector<int> v;
+    v.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        v.push_back_unchecked(i);
+    }
+    REQUIRE(v.size() == 100);
+    REQUIRE(v[99] == 99);
+    std::string s = "moved";
+    mystl::my_vector<std::string> strings;
+    strings.reserve(2);
+    strings.push_back_unchecked(std::move(s));
+    strings.emplace_back_unchecked(3, 'x');
+    REQUIRE(strings[0] == "moved");
+    REQUIRE(strings[1] == "xxx");
+#if MYSTL_BOUNDS_CHECK
+    REQUIRE_THROWS_AS(strings.push_back_unchecked("full"), std::out_of_range);
+#endif
+}
+
+TEST_CASE("vector append") {
+    mystl::my_vector<int> v{1, 2};
+    std::vector<int> src{3, 4, 5};
+    v.append(src.begin(), src.end());
+    REQUIRE(v == mystl::my_vector<int>{1, 2, 3, 4, 5});
+
+    std::list<int> l{6, 7};
+    v.append(l.begin(), l.end());
+    REQUIRE(v.size() == 7);
+    REQUIRE(v[6] == 7);
+
+    std::istringstream in("8 9");
+    v.append(std::istream_iterator<int>(in), std::istream_iterator<int>());
+    REQUIRE(v.size() == 9);
+    REQUIRE(v[8] == 9);
+
+    // own elements, with and without growing
+    v.shrink_to_fit();
+    v.append(v.data(), v.data() + 3);
+    REQUIRE(v.size() == 12);
+    REQUIRE(v[11] == 3);
+    v.reserve(100);
+    v.append(v.data(), v.data() + 2);
+    REQUIRE(v[13] == 2);
+}
+
+TEST_CASE("vector append_n") {
+    mystl::my_vector<std::string> v{"a"};
+    int counter = 0;
+    v.append_n(5, [&counter] { return std::to_string(counter++); });
+    REQUIRE(v.size() == 6);
+    REQUIRE(v[1] == "0");
+    REQUIRE(v[5] == "4");
+
+    // a throwing generator appends nothing
+    counter = 0;
+    REQUIRE_THROWS(v.append_n(5, [&counter] {
+        if (counter == 3) throw std::runtime_error("gen");
+        return std::to_string(counter++);
+    }));
+    REQUIRE(v.size() == 6);
+}
+
+TEST_CASE("vector uninitialized_append") {
+    mystl::my_vector<char> buffer;
+    const std::string text = "parsed input";
+    char* dest = buffer.uninitialized_append(64);
+    REQUIRE(buffer.size() == 64);
+    std::copy(text.begin(), text.end(), dest);
+    // only part of the space was used -> give the rest back
+    buffer.resize(text.size());
+    REQUIRE(std::string(buffer.data(), buffer.size()) == text);
+
+    dest = buffer.uninitialized_append(2);
+    dest[0] = '!';
+    dest[1] = '?';
+    REQUIRE(buffer.size() == text.size() + 2);
+    REQUIRE(buffer[text.size() + 1] == '?');
+}
@@ -747,4 +747,94 @@ TEST_CASE("boundary - reverse iterator base") {
     // base points one position ahead in forward iteration
     --base;
     REQUIRE(*base == 2);
-}
\ No newline at end of file
+}
+// ============================================================
+// CHECKED ITERATOR TESTS
+// Only built with MYSTL_CHECKED_ITERATORS=1 (tests_vector_iterator_checked)
+// ============================================================
+
+#if MYSTL_CHECKED_ITERATORS
+#include <stdexcept>
+
+TEST_CASE("checked iterator - stale after reallocation") {
+    mystl::my_vector<int> v;
+    v.reserve(2);
+    v.push_back(1);
+    v.push_back(2);
+
+    auto it = v.begin();
+    v.push_back(3);  // reallocates
+    REQUIRE_THROWS_AS(*it, std::logic_error);
+    REQUIRE_THROWS_AS(it == v.begin(), std::logic_error);
+    REQUIRE(*v.begin() == 1);
+}
+
+TEST_CASE("checked iterator - stale after reserve") {
+    mystl::my_vector<int> v{1, 2, 3};
+    auto it = v.cbegin();
+    v.reserve(100);
+    REQUIRE_THROWS_AS(*it, std::logic_error);
+    // reserve without growing keeps iterators valid
+    auto fresh = v.cbegin();
+    v.reserve(10);
+    REQUIRE(*fresh == 1);
+}
+
+TEST_CASE("checked iterator - stale after clear") {
+    mystl::my_vector<int> v{1, 2};
+    auto it = v.begin();
+    v.clear();
+    REQUIRE_THROWS_AS(*it, std::logic_error);
+    v.push_back(5);
+    REQUIRE_THROWS_AS(*it, std::logic_error);
+}
+
+TEST_CASE("checked iterator - popped element") {
+    mystl::my_vector<int> v{1, 2, 3};
+    auto last = v.begin() + 2;
+    auto first = v.begin();
+    v.pop_back();
+    REQUIRE_THROWS_AS(*last, std::logic_error);
+    // the remaining elements are still fine
+    REQUIRE(*first == 1);
+    REQUIRE(last == v.end());
+}
+
+TEST_CASE("checked iterator - out of range access") {
+    mystl::my_vector<int> v{1, 2, 3};
+    REQUIRE_THROWS_AS(*v.end(), std::logic_error);
+    REQUIRE_THROWS_AS(v.begin()[3], std::logic_error);
+    REQUIRE_THROWS_AS(*(v.begin() - 1), std::logic_error);
+    mystl::my_vector<int>::iterator singular;
+    REQUIRE_THROWS_AS(*singular, std::logic_error);
+}
+
+TEST_CASE("checked iterator - stale iterator passed to insert and erase") {
+    mystl::my_vector<int> v{1, 2, 3};
+    auto it = v.begin();
+    v.shrink_to_fit();
+    v.push_back(4);
+    REQUIRE_THROWS_AS(v.insert(it, 0), std::logic_error);
+    REQUIRE_THROWS_AS(v.erase(it), std::logic_error);
+    mystl::my_vector<int> other{7};
+    REQUIRE_THROWS_AS(v.erase(other.begin()), std::logic_error);
+}
+
+TEST_CASE("checked iterator - returned iterators are fresh") {
+    mystl::my_vector<int> v;
+    for (int i = 0; i < 10; i++) {
+        v.push_back(i);
+    }
+    for (auto it = v.begin(); it != v.end();) {
+        if (*it % 2 == 0) {
+            it = v.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    REQUIRE(v.size() == 5);
+    auto it = v.insert(v.begin(), 100, -1);  // reallocates
+    REQUIRE(*it == -1);
+    REQUIRE(*(it + 100) == 1);
+}
+#endif
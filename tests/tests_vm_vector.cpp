@@ -0,0 +1,175 @@
+/*
+ * THESE TESTS WERE WRITTEN WITH THE HELP OF AI
+ */
+#include "../source/vm_vector.hpp"
+#include "../extras/catch_amalgamated.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+// counts live instances so leaks and double destroys show up
+struct counted {
+    static int live;
+    int value;
+    counted(int v = 0) : value(v) { ++live; }
+    counted(const counted& o) : value(o.value) { ++live; }
+    ~counted() { --live; }
+};
+int counted::live = 0;
+
+// throws on the construction with the given value
+struct throwing {
+    int value;
+    throwing(int v) : value(v) {
+        if (v == 13) throw std::runtime_error("unlucky");
+    }
+};
+} // namespace
+
+TEST_CASE("vm push_back never moves elements") {
+    mystl::vm_vector<std::uint64_t> v;
+    v.push_back(42);
+    const std::uint64_t* first = v.data();
+    const std::uint64_t& ref = v[0];
+    auto it = v.begin();
+    for (std::uint64_t i = 1; i < 2000000; ++i) v.push_back(i);
+    REQUIRE(v.data() == first);
+    REQUIRE(ref == 42);
+    REQUIRE(*it == 42);
+    REQUIRE(v[1999999] == 1999999);
+}
+
+TEST_CASE("vm default vector doesnt reserve anything") {
+    mystl::vm_vector<int> v;
+    REQUIRE(v.data() == nullptr);
+    REQUIRE(v.capacity() == 0);
+    REQUIRE(v.max_size() == mystl::vm_vector<int>::default_reserve_bytes / sizeof(int));
+    REQUIRE(v.begin() == v.end());
+}
+
+TEST_CASE("vm capacity covers whole pages") {
+    mystl::vm_vector<int> v;
+    v.reserve(1);
+    REQUIRE(v.capacity() >= 1);
+    REQUIRE(v.capacity() * sizeof(int) % mystl::detail::vm_page_size() == 0);
+    size_t cap = v.capacity();
+    for (size_t i = 0; i < cap; ++i) v.push_back(static_cast<int>(i));
+    REQUIRE(v.capacity() == cap);
+}
+
+TEST_CASE("vm growth stops at max_size") {
+    mystl::vm_vector<int> v(1000);
+    for (int i = 0; i < 1000; ++i) v.push_back(i);
+    REQUIRE(v.capacity() == 1000);
+    REQUIRE_THROWS_AS(v.push_back(1000), std::length_error);
+    REQUIRE_THROWS_AS(v.reserve(1001), std::length_error);
+    REQUIRE(v.size() == 1000);
+    REQUIRE(v[999] == 999);
+}
+
+TEST_CASE("vm shrink_to_fit keeps the limit of a partial page") {
+    mystl::vm_vector<int> v(10);
+    for (int i = 0; i < 10; ++i) v.push_back(i);
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 10);
+    REQUIRE_THROWS_AS(v.push_back(10), std::length_error);
+    v.resize(5);
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 10);
+    for (int i = 5; i < 10; ++i) v.push_back(i);
+    REQUIRE_THROWS_AS(v.push_back(10), std::length_error);
+    REQUIRE(v.size() == 10);
+    REQUIRE(v[9] == 9);
+}
+
+TEST_CASE("vm emplace_back of an own element while growing") {
+    mystl::vm_vector<std::string> v;
+    v.push_back(std::string(50, 'x'));
+    while (v.size() < v.capacity()) v.emplace_back(v[0]);
+    // this one commits new pages
+    v.emplace_back(v[0]);
+    REQUIRE(v[v.size() - 1] == std::string(50, 'x'));
+}
+
+TEST_CASE("vm elements are destroyed") {
+    counted::live = 0;
+    {
+        mystl::vm_vector<counted> v;
+        for (int i = 0; i < 10000; ++i) v.emplace_back(i);
+        REQUIRE(counted::live == 10000);
+        v.pop_back();
+        REQUIRE(counted::live == 9999);
+        v.resize(100);
+        REQUIRE(counted::live == 100);
+        v.resize(200, counted(7));
+        REQUIRE(counted::live == 200);
+        REQUIRE(v[150].value == 7);
+    }
+    REQUIRE(counted::live == 0);
+}
+
+TEST_CASE("vm failed construction leaves the vector as it was") {
+    mystl::vm_vector<throwing> v;
+    for (int i = 0; i < 13; ++i) v.emplace_back(i);
+    REQUIRE_THROWS_AS(v.emplace_back(13), std::runtime_error);
+    REQUIRE(v.size() == 13);
+    v.emplace_back(14);
+    REQUIRE(v[13].value == 14);
+}
+
+TEST_CASE("vm shrink_to_fit decommits and growth continues") {
+    mystl::vm_vector<std::uint32_t> v;
+    v.resize(1000000);
+    const std::uint32_t* first = v.data();
+    v.resize(10);
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() < 1000000);
+    REQUIRE(v.capacity() >= 10);
+    REQUIRE(v.data() == first);
+    // recommitted pages are zero again
+    v.resize(1000000);
+    REQUIRE(v[999999] == 0);
+    REQUIRE(v.data() == first);
+    v.clear();
+    v.shrink_to_fit();
+    REQUIRE(v.capacity() == 0);
+    v.push_back(5);
+    REQUIRE(v[0] == 5);
+}
+
+TEST_CASE("vm move keeps the storage") {
+    mystl::vm_vector<int> a;
+    for (int i = 0; i < 100; ++i) a.push_back(i);
+    const int* first = a.data();
+    mystl::vm_vector<int> b(std::move(a));
+    REQUIRE(b.data() == first);
+    REQUIRE(a.empty());
+    REQUIRE(a.data() == nullptr);
+    mystl::vm_vector<int> c;
+    c.push_back(1);
+    c = std::move(b);
+    REQUIRE(c.data() == first);
+    REQUIRE(c.size() == 100);
+    // the moved from vector can grow again
+    a.push_back(3);
+    REQUIRE(a[0] == 3);
+}
+
+TEST_CASE("vm access and comparison") {
+    mystl::vm_vector<int> a;
+    mystl::vm_vector<int> b;
+    for (int i = 0; i < 5; ++i) {
+        a.push_back(i);
+        b.push_back(i);
+    }
+    REQUIRE(a == b);
+    b[4] = 9;
+    REQUIRE(a != b);
+    REQUIRE_THROWS_AS(a.at(5), std::out_of_range);
+    int sum = 0;
+    for (auto it = a.rbegin(); it != a.rend(); ++it) sum = sum * 10 + *it;
+    REQUIRE(sum == 43210);
+    mystl::vm_vector<int> empty;
+    REQUIRE_THROWS_AS(empty.pop_back(), std::out_of_range);
+}